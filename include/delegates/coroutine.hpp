@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2025, Alex Bobryshev <alexbobryshev555@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DELEGATES_COROUTINE_HEADER
+#define DELEGATES_COROUTINE_HEADER
+
+// Opt-in C++20 coroutines support, not included by delegates.hpp
+// Delegate call is posted to executor, awaiting coroutine is resumed directly by executor thread when call is finished.
+// Call finished before await_suspend() returns (inline executor, or fast call in other thread) does not resume
+// coroutine from the task: await_suspend() returns false and coroutine continues without suspension,
+// so stack does not grow over loop of inline awaits
+
+#if !defined(__cpp_impl_coroutine)
+#error "delegates/coroutine.hpp requires C++20 coroutines support"
+#endif
+
+#include "delegates.hpp"
+#include <atomic>
+#include <coroutine>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+DELEGATES_BASE_NAMESPACE_BEGIN
+
+namespace delegates {
+
+/// \brief    Executor which calls delegate in the awaiting thread, coroutine continues without suspension.
+///           Executor is any object callable with nullary task: executor(task), task must be called once
+struct InlineExecutor {
+  template<typename F>
+  void operator()(F&& task) const { task(); }
+};
+
+/// \brief    Awaiter of untyped delegate call
+///           co_await result is IDelegateResult* with call result, or nullptr if call failed
+template<typename TExecutor>
+class DelegateAwaiter {
+ public:
+  DelegateAwaiter(IDelegate* delegate, IDelegateCallFrame* frame, TExecutor executor)
+    : delegate_(delegate), frame_(frame), executor_(std::move(executor)) {}
+
+  bool await_ready() const noexcept { return false; }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    // executor is moved out of awaiter, awaiter lives in coroutine frame and is not touched after completion flag
+    TExecutor executor(std::move(executor_));
+    executor([this, handle]() {
+      ok_ = frame_ ? delegate_->call(*frame_) : delegate_->call();
+      // the second of task and await_suspend() resumes coroutine
+      if (completed_.exchange(true, std::memory_order_acq_rel))
+        handle.resume();
+    });
+    return !completed_.exchange(true, std::memory_order_acq_rel);
+  }
+
+  IDelegateResult* await_resume() const noexcept {
+    if (!ok_)
+      return nullptr;
+    return frame_ ? frame_->result() : delegate_->result();
+  }
+
+ private:
+  IDelegate* delegate_;
+  IDelegateCallFrame* frame_;
+  TExecutor executor_;
+  bool ok_ = false;
+  std::atomic<bool> completed_{ false };
+};
+
+/// \brief    Awaiter of typed delegate call. Arguments and result are kept in call frame inside awaiter,
+///           so the same delegate may be awaited by many coroutines at once.
+///           co_await result is call result, failed call is reported by exception (std::abort() without exceptions)
+template<typename TExecutor, typename TResult, typename... TArgs>
+class TypedDelegateAwaiter {
+ public:
+  template<typename... TCallArgs>
+  TypedDelegateAwaiter(IDelegate* delegate, TExecutor executor, TCallArgs&&... args)
+    : delegate_(delegate), executor_(std::move(executor)), frame_(std::forward<TCallArgs>(args)...) {}
+
+  bool await_ready() const noexcept { return false; }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    // see DelegateAwaiter::await_suspend()
+    TExecutor executor(std::move(executor_));
+    executor([this, handle]() {
+      ok_ = delegate_->call(frame_);
+      if (completed_.exchange(true, std::memory_order_acq_rel))
+        handle.resume();
+    });
+    return !completed_.exchange(true, std::memory_order_acq_rel);
+  }
+
+  TResult await_resume() {
+    if (!ok_)
+      DELEGATES_THROW(std::runtime_error("Delegate call failed"));
+
+    if constexpr (!std::is_void_v<TResult>)
+      return frame_.result()->template take<std::decay_t<TResult> >();
+  }
+
+ private:
+  IDelegate* delegate_;
+  TExecutor executor_;
+  DelegateCallFrame<TResult, TArgs...> frame_;
+  bool ok_ = false;
+  std::atomic<bool> completed_{ false };
+};
+
+/// \brief    Await delegate call with stored arguments on executor. Result is kept in delegate result
+template<typename TExecutor>
+DelegateAwaiter<TExecutor> async_call(IDelegate* delegate, TExecutor executor) {
+  return DelegateAwaiter<TExecutor>(delegate, nullptr, std::move(executor));
+}
+
+/// \brief    Await reentrant delegate call with caller owned frame on executor. Result is kept in frame
+template<typename TExecutor>
+DelegateAwaiter<TExecutor> async_call(IDelegate* delegate, IDelegateCallFrame& frame, TExecutor executor) {
+  return DelegateAwaiter<TExecutor>(delegate, &frame, std::move(executor));
+}
+
+/// \brief    Await typed delegate call on executor: TResult r = co_await async_call(typed, executor, args...)
+template<typename TExecutor, typename TResult, typename... TArgs, typename... TCallArgs>
+TypedDelegateAwaiter<TExecutor, TResult, TArgs...> async_call(TypedDelegate<TResult, TArgs...>& delegate,
+  TExecutor executor, TCallArgs&&... args) {
+  return TypedDelegateAwaiter<TExecutor, TResult, TArgs...>(delegate.get_interface(), std::move(executor),
+    std::forward<TCallArgs>(args)...);
+}
+
+}//namespace delegates
+
+DELEGATES_BASE_NAMESPACE_END
+
+#endif //DELEGATES_COROUTINE_HEADER
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2025, Alex Bobryshev <alexbobryshev555@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DELEGATES_DELEGATE_REF_HEADER
+#define DELEGATES_DELEGATE_REF_HEADER
+
+#include "delegates_conf.h"
+#include "i_delegate.h"
+#include "detail/delegate_impl.hpp"
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+DELEGATES_BASE_NAMESPACE_BEGIN
+
+namespace delegates {
+
+template<typename TSignature>
+class DelegateRef;
+
+/// \brief    Non-owning reference to callable: lambda, functor, free function or method of existing object.
+///           Two pointers wide, never allocates and calls target through single indirect call.
+///           Intended for synchronous callbacks passed as function parameters, referenced callable must outlive
+///           DelegateRef (and IDelegate created from it by make_unique()/make_shared())
+template<typename TResult, typename... TArgs>
+class DelegateRef<TResult(TArgs...)> {
+ public:
+  typedef TResult result_type;
+
+  /// \brief    Create empty reference, it must not be called
+  DelegateRef() noexcept : thunk_(nullptr) { callee_.object_ = nullptr; }
+
+  /// \brief    Reference free function
+  DelegateRef(TResult (*func)(TArgs...)) noexcept : thunk_(func ? &call_function : nullptr) {
+    callee_.function_ = reinterpret_cast<void (*)()>(func);
+  }
+
+  /// \brief    Reference lambda or functor, callable is not copied
+  template<typename F, typename = typename std::enable_if<
+    !std::is_same<typename std::decay<F>::type, DelegateRef>::value &&
+    !std::is_pointer<typename std::decay<F>::type>::value>::type>
+  DelegateRef(F&& callable) noexcept : thunk_(&call_object<typename std::remove_reference<F>::type>) {
+    callee_.object_ = const_cast<void*>(static_cast<const void*>(std::addressof(callable)));
+  }
+
+  /// \brief    Reference class method of existing object, e.g. DelegateRef<int(int)>::bind<Calc, &Calc::add>(&calc)
+  template<typename TClass, TResult (TClass::*TMethod)(TArgs...)>
+  static DelegateRef bind(TClass* callee) noexcept {
+    DelegateRef ref;
+    ref.callee_.object_ = callee;
+    ref.thunk_ = &call_method<TClass, TMethod>;
+    return ref;
+  }
+
+  /// \brief    Reference class const method of existing object
+  template<typename TClass, TResult (TClass::*TMethod)(TArgs...) const>
+  static DelegateRef bind(const TClass* callee) noexcept {
+    DelegateRef ref;
+    ref.callee_.object_ = const_cast<TClass*>(callee);
+    ref.thunk_ = &call_const_method<TClass, TMethod>;
+    return ref;
+  }
+
+  /// \brief    Call referenced target. Reference must not be empty
+  TResult operator()(TArgs... args) const {
+    return thunk_(callee_, std::forward<TArgs>(args)...);
+  }
+
+  /// \brief    Check if reference is not empty
+  explicit operator bool() const noexcept { return thunk_ != nullptr; }
+
+  /// \brief    Create delegate with arguments and result storage for deferred call of the same target.
+  ///           Target is referenced, not copied: it must outlive created delegate
+  std::unique_ptr<IDelegate> make_unique(DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) const {
+    return std::make_unique<LambdaDelegate<TResult, DelegateRef, TArgs...> >(DelegateRef(*this), std::move(params));
+  }
+
+  template<bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+  std::unique_ptr<IDelegate> make_unique(TArgs... args) const {
+    return make_unique(DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+  }
+
+  /// \brief    Create shared delegate for deferred call of the same target. Target must outlive created delegate
+  std::shared_ptr<IDelegate> make_shared(DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) const {
+    return std::make_shared<LambdaDelegate<TResult, DelegateRef, TArgs...> >(DelegateRef(*this), std::move(params));
+  }
+
+  template<bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+  std::shared_ptr<IDelegate> make_shared(TArgs... args) const {
+    return make_shared(DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+  }
+
+ private:
+  // object pointer and function pointer are not convertible to each other, so both are kept in union
+  union Callee {
+    void* object_;
+    void (*function_)();
+  };
+
+  typedef TResult (*Thunk)(Callee, TArgs&&...);
+
+  static TResult call_function(Callee callee, TArgs&&... args) {
+    return reinterpret_cast<TResult (*)(TArgs...)>(callee.function_)(std::forward<TArgs>(args)...);
+  }
+
+  template<typename F>
+  static TResult call_object(Callee callee, TArgs&&... args) {
+    return (*static_cast<F*>(callee.object_))(std::forward<TArgs>(args)...);
+  }
+
+  template<typename TClass, TResult (TClass::*TMethod)(TArgs...)>
+  static TResult call_method(Callee callee, TArgs&&... args) {
+    return (static_cast<TClass*>(callee.object_)->*TMethod)(std::forward<TArgs>(args)...);
+  }
+
+  template<typename TClass, TResult (TClass::*TMethod)(TArgs...) const>
+  static TResult call_const_method(Callee callee, TArgs&&... args) {
+    return (static_cast<const TClass*>(callee.object_)->*TMethod)(std::forward<TArgs>(args)...);
+  }
+
+  Callee callee_;
+  Thunk thunk_;
+};
+
+}//namespace delegates
+
+DELEGATES_BASE_NAMESPACE_END
+
+#endif //DELEGATES_DELEGATE_REF_HEADER
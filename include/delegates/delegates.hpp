@@ -29,5 +29,6 @@
 #include "detail/signal.hpp"
 #include "detail/factory.hpp"
 #include "typed_delegate.hpp"
+#include "delegate_ref.hpp"
 
 #endif //DELEGATES_HEADER
@@ -42,4 +42,33 @@
 // Trace mode: print message to cerr on errors
 #define DELEGATES_TRACE   1
 
+// Exceptions support, detected from compiler flags. May be set to 0 by user.
+// Without exceptions (e.g. -fno-exceptions) errors are reported by return codes only, strict mode is disabled.
+// Errors which can't be reported by return value (type error in get<T>(), failed TypedDelegate call or
+// construction) call std::abort(): use try_get(), call() or has_value() checks in such builds.
+// Library does not use RTTI, so no configuration is needed for -fno-rtti
+#ifndef DELEGATES_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define DELEGATES_EXCEPTIONS 1
+#else
+#define DELEGATES_EXCEPTIONS 0
+#endif
+#endif //DELEGATES_EXCEPTIONS
+
+#if DELEGATES_EXCEPTIONS
+#define DELEGATES_THROW(exception) throw exception
+#else
+#include <cstdlib>
+#undef DELEGATES_STRICT
+#define DELEGATES_STRICT  0
+#define DELEGATES_THROW(exception) std::abort()
+#endif //DELEGATES_EXCEPTIONS
+
+// Error paths are kept out of line, so hot accessors stay small enough for inlining
+#if defined(_MSC_VER) && !defined(__clang__)
+#define DELEGATES_NOINLINE __declspec(noinline)
+#else
+#define DELEGATES_NOINLINE __attribute__((noinline, cold))
+#endif
+
 #endif //DELEGAGES_CONF_HEADER
@@ -38,10 +38,23 @@ DELEGATES_BASE_NAMESPACE_BEGIN
 namespace delegates {
 namespace detail {
 
+// true if any of values is true
+template<size_t N>
+constexpr bool any_of_values(const bool (&values)[N]) {
+  for (size_t i = 0; i < N; i++) {
+    if (values[i])
+      return true;
+  }
+  return false;
+}
+
 /// \brief    Delegate arguments implementation. N is arguments count, TArgs - arguments types list
 template<std::size_t N, typename... TArgs>
 class DelegateArgsImpl
   : public delegates::IDelegateArgs {
+  static_assert(!any_of_values<N + 1>({ false, is_unnamed_type<TArgs>::value... }),
+    "Closure types can't be delegate arguments: their type_id() is not unique");
+
   // disable copying
   DelegateArgsImpl(const DelegateArgsImpl&) {}
   DelegateArgsImpl& operator=(const DelegateArgsImpl&) { return *this;  }
@@ -49,59 +62,57 @@ class DelegateArgsImpl
 public:
   DelegateArgsImpl(DelegateArgsImpl&& params) noexcept
     : values_args_(std::move(params.values_args_))
-    , def_args_(std::tuple<typename std::decay<TArgs>::type...> {})
-    , ref_args_(tuple_runtime::ref_tuple(values_args_))
-    , deleters_(std::move(params.deleters_))  {}
+    , ref_args_(tuple_runtime::ref_tuple(values_args_)) {
+    for (size_t i = 0; i < N; i++)
+      deleters_[i] = std::move(params.deleters_[i]);
+  }
 
   explicit DelegateArgsImpl(TArgs&&... args)
     : values_args_(std::forward<TArgs>(args)...)
-    , def_args_(std::tuple<typename std::decay<TArgs>::type...> {})
-    , ref_args_(tuple_runtime::ref_tuple(values_args_)) { 
-    setup_deleters(); 
-  }
+    , ref_args_(tuple_runtime::ref_tuple(values_args_)) {}
 
   // Constructor with std::nullptr_t{} parameter means that arguments are initialized with default values
   DelegateArgsImpl(std::nullptr_t) noexcept
     : values_args_(std::tuple<typename std::decay<TArgs>::type...> {})  // default args used for empty initialization when some of arguments are references
-    , def_args_(std::tuple<typename std::decay<TArgs>::type...> {})
-    , ref_args_(tuple_runtime::ref_tuple(values_args_)) {
-    setup_deleters();
-  }
+    , ref_args_(tuple_runtime::ref_tuple(values_args_)) {}
 
   ~DelegateArgsImpl() override { clear(); }
 
   void clear() override {
-    for(size_t i=0; i<deleters_.size(); i++)
-      clear(i);
+    for(size_t i=0; i<N; i++)
+      clear_unchecked(i);
   }
 
   void clear(size_t idx) override {
-    using tuple_type=typename std::remove_reference<std::tuple<TArgs...> >::type;
-    void* ptr = get_ptr(idx);
-    if (ptr && deleters_[idx])
-      deleters_[idx](ptr);
-
-    tuple_runtime::runtime_tuple_set_value_ptr(values_args_, def_args_, idx, nullptr, 0);
-    deleters_[idx] = [](void*) {};
+    if (!check_index(idx))
+      return;
+    clear_unchecked(idx);
   }
 
-  bool set_ptr(size_t idx, void* pv, size_t type_hash, std::function<void(void*)> deleter_ptr = [](void* ptr) {}) override  {
-    using tuple_type=typename std::remove_reference<std::tuple<TArgs...> >::type;
-    clear(idx);
-    if (tuple_runtime::runtime_tuple_set_value_ptr(values_args_, def_args_, idx, pv, type_hash)) {
-      deleters_[idx] = deleter_ptr;
+  bool set_ptr(size_t idx, void* pv, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override  {
+    if (!check_index(idx))
+      return false;
+
+    clear_unchecked(idx);
+    if (tuple_runtime::runtime_tuple_set_value_ptr_unchecked(values_args_, idx, pv, type_hash)) {
+      deleters_[idx] = std::move(deleter);
       return true;
     }
 
-#if DELEGATES_TRACE
-    std::cerr << "Delegate argument was not set, idx=" << idx << ", type hash " << type_hash << std::endl;
-#endif //DELEGATES_TRACE
+    return set_failed(idx, type_hash);
+  }
 
-#if DELEGATES_STRICT
-    throw std::runtime_error("Delegate argument was not set");
-#endif //DELEGATES_STRICT
+  bool set_move_ptr(size_t idx, void* pv, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override  {
+    if (!check_index(idx))
+      return false;
 
-    return false;
+    clear_unchecked(idx);
+    if (tuple_runtime::runtime_tuple_move_value_ptr_unchecked(values_args_, idx, pv, type_hash)) {
+      deleters_[idx] = std::move(deleter);
+      return true;
+    }
+
+    return set_failed(idx, type_hash);
   }
 
   size_t size() const override {
@@ -110,30 +121,85 @@ public:
   }
 
   size_t hash_code(size_t idx) const override {
-    using tuple_type=typename std::remove_reference<std::tuple<TArgs&...> >::type;
-    return tuple_runtime::runtime_tuple_get_element_type_hash(ref_args_, idx);
+    if (!check_index(idx))
+      return 0;
+    return tuple_runtime::runtime_tuple_get_element_type_hash_unchecked(ref_args_, idx);
   }
 
+  size_t signature() const override { return signature_id<TArgs...>(); }
+
   void* get_ptr(size_t idx) const override  {
     using tuple_type=typename std::remove_reference<std::tuple<TArgs&...> >::type;
-    return tuple_runtime::runtime_tuple_get_value_ptr(const_cast<tuple_type&>(ref_args_), idx);
+    if (!check_index(idx))
+      return nullptr;
+    return tuple_runtime::runtime_tuple_get_value_ptr_unchecked(const_cast<tuple_type&>(ref_args_), idx);
+  }
+
+  bool get_ptrs(void** ptrs, size_t count) const override {
+    if (count != N)
+      return false;
+
+    get_ptrs(ptrs, std::make_index_sequence<N>{});
+    return true;
   }
 
   std::tuple<TArgs&...>& get_tuple() { return ref_args_; }
   const std::tuple<TArgs&...>& get_tuple() const { return ref_args_; }
 
  private:
-  void setup_deleters() {
-    using tuple_type=typename std::remove_reference<std::tuple<TArgs...> >::type;
-    size_t constexpr args_count = std::tuple_size<tuple_type>::value;
-    deleters_.resize(args_count);
+  // index is validated once here, tuple is accessed by unchecked accessors after it
+  static bool check_index(size_t idx) {
+    if (idx < N)
+      return true;
+    return index_out_of_range(idx);
+  }
+
+  DELEGATES_NOINLINE static bool index_out_of_range(size_t idx) {
+    (void)idx;
+#if DELEGATES_TRACE
+    std::cerr << "Delegate argument index is out of range, idx=" << idx << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_EXCEPTIONS
+    throw std::runtime_error("Out of range");
+#else
+    return false;
+#endif //DELEGATES_EXCEPTIONS
   }
 
-  // contains non-reference non-const default arguments tuple which is used for initialization when Empty{} arguments are provided
-  std::tuple<typename std::decay<TArgs>::type...> def_args_;
+  void clear_unchecked(size_t idx) {
+    using tuple_type=typename std::remove_reference<std::tuple<TArgs&...> >::type;
+    void* ptr = tuple_runtime::runtime_tuple_get_value_ptr_unchecked(const_cast<tuple_type&>(ref_args_), idx);
+    if (ptr && deleters_[idx])
+      deleters_[idx](ptr);
+
+    tuple_runtime::runtime_tuple_set_value_ptr_unchecked(values_args_, idx, nullptr, 0);
+  }
+
+  template<size_t... Is>
+  void get_ptrs(void** ptrs, std::index_sequence<Is...>) const {
+    using array_type = int[];
+    (void)array_type{0, (ptrs[Is] = const_cast<void*>(static_cast<const void*>(&std::get<Is>(ref_args_))), 0)...};
+  }
+
+  static bool set_failed(size_t idx, size_t type_hash) {
+    (void)idx; (void)type_hash;
+#if DELEGATES_TRACE
+    std::cerr << "Delegate argument was not set, idx=" << idx << ", type hash " << type_hash << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+    throw std::runtime_error("Delegate argument was not set");
+#endif //DELEGATES_STRICT
+
+    return false;
+  }
+
+  // cleared arguments are reset to default constructed values on demand, no default values copy is kept
   std::tuple<typename std::decay<TArgs>::type...> values_args_;
   std::tuple<TArgs&...> ref_args_;
-  std::vector<std::function<void(void*)> > deleters_;
+  // deleters are stored inline, one per argument. Empty deleter means argument has no deleter
+  DelegateDeleter deleters_[N];
 };
 
 /// \brief    Delegates arguments specialization for empty list
@@ -151,8 +217,8 @@ public:
 
   void clear() override {}
   void clear(size_t idx) override { (void)idx; }
-  bool set_ptr(size_t idx, void* pv, size_t type_hash, std::function<void(void*)> deleter_ptr = [](void*) {}) override {
-    (void)idx; (void)pv; (void)type_hash; (void)deleter_ptr;
+  bool set_ptr(size_t idx, void* pv, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override {
+    (void)idx; (void)pv; (void)type_hash; (void)deleter;
 #if DELEGATES_TRACE
     std::cerr << "DelegateArgs: called set() for void argument" << std::endl;
 #endif //DELEGATES_TRACE
@@ -164,7 +230,12 @@ public:
     return false;
   }
 
+  bool set_move_ptr(size_t idx, void* pv, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override {
+    return set_ptr(idx, pv, type_hash, std::move(deleter));
+  }
+
   size_t size() const override { return 0; }
+  size_t signature() const override { return signature_id<>(); }
 
   size_t hash_code(size_t idx) const override { 
     (void)idx;
@@ -23,6 +23,7 @@
 #ifndef DELEGATES_DELEGATE_IMPL_HEADER
 #define DELEGATES_DELEGATE_IMPL_HEADER
 
+#include <algorithm>
 #include <functional>
 #include <tuple>
 #include <memory>
@@ -31,6 +32,7 @@
 #include <mutex>
 #include <cstddef>
 #include <cstdint>
+#include <new>
 
 #if DELEGATES_STRICT
 #include <stdexcept>
@@ -44,11 +46,40 @@
 #include "tuple_runtime.hpp"
 #include "delegate_result_impl.hpp"
 #include "delegate_args_impl.hpp"
+#include "delegate_recycler.hpp"
 
 DELEGATES_BASE_NAMESPACE_BEGIN
 
 namespace delegates {
 
+/// \brief    Caller owned arguments and result storage for reentrant delegate call, may be allocated on stack:
+///           DelegateCallFrame<int, int, int> frame(1, 2); delegate->call(frame); frame.result()->get<int>();
+///           Frame types must be exactly the same as delegate types
+template<typename TResult, typename... TArgs>
+class DelegateCallFrame : public IDelegateCallFrame {
+ public:
+  DelegateCallFrame() = default;
+
+  template<bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+  explicit DelegateCallFrame(TArgs... args) : args_(std::forward<TArgs>(args)...) {}
+
+  explicit DelegateCallFrame(DelegateArgs<TArgs...>&& args) : args_(std::move(args)) {}
+
+  size_t frame_type() const override { return type_id<DelegateCallFrame>(); }
+  IDelegateArgs* args() override { return &args_; }
+  IDelegateResult* result() override { return &result_; }
+
+  DelegateArgs<TArgs...>& typed_args() { return args_; }
+  detail::DelegateResult<TResult>& typed_result() { return result_; }
+
+ private:
+  DelegateCallFrame(const DelegateCallFrame&) = delete;
+  DelegateCallFrame& operator=(const DelegateCallFrame&) = delete;
+
+  DelegateArgs<TArgs...> args_;
+  detail::DelegateResult<TResult> result_;
+};
+
 namespace detail {
 
 // Opt-in debugging aid, off by default: it adds a word to every delegate and a
@@ -84,10 +115,148 @@ namespace detail {
   } while (0)
 #endif  // DELEGATES_LIFETIME_GUARD
 
+/// \brief    Type used to pass stored argument to callee. Move-only arguments taken by value are moved out of
+///           arguments storage, all others are passed as lvalues so stored values are kept for next calls
+template<typename TArg>
+using invoke_arg_type = typename std::conditional<
+  !std::is_reference<TArg>::value && !std::is_copy_constructible<TArg>::value, TArg&&, TArg&>::type;
+
+template<typename TArg>
+invoke_arg_type<TArg> invoke_arg(typename std::remove_reference<TArg>::type& arg) {
+  return static_cast<invoke_arg_type<TArg> >(arg);
+}
+
+// batch column must not be const when target modifies argument or moves it out
+template<typename TArg>
+using batch_mutable_column = std::integral_constant<bool, std::is_rvalue_reference<TArg>::value ||
+  (std::is_lvalue_reference<TArg>::value && !std::is_const<typename std::remove_reference<TArg>::type>::value) ||
+  (!std::is_reference<TArg>::value && !std::is_copy_constructible<TArg>::value)>;
+
+template<typename... TArgs>
+constexpr size_t batch_mutable_columns() {
+  return static_cast<size_t>(arguments_mask<sizeof...(TArgs) + 1>({ false, batch_mutable_column<TArgs>::value... }));
+}
+
+/// \brief    Results array element type for batch call, void delegates have no results array
+template<typename TResult>
+using batch_results_type = typename std::conditional<std::is_void<TResult>::value,
+  void, typename std::decay<TResult>::type>::type*;
+
+// column element type for argument type
+template<typename TArg>
+using batch_column_type = typename std::remove_cv<typename std::remove_reference<TArg>::type>::type*;
+
+// results are not stored
+template<typename... TArgs, typename F, typename TResults, std::size_t... Is>
+void batch_invoke_rows(F& func, const std::tuple<batch_column_type<TArgs>...>& cols, size_t count, TResults,
+  std::index_sequence<Is...>, std::false_type) {
+  for (size_t row = 0; row < count; row++)
+    func(invoke_arg<TArgs>(std::get<Is>(cols)[row])...);
+}
+
+template<typename... TArgs, typename F, typename TResults, std::size_t... Is>
+void batch_invoke_rows(F& func, const std::tuple<batch_column_type<TArgs>...>& cols, size_t count, TResults results,
+  std::index_sequence<Is...>, std::true_type) {
+  for (size_t row = 0; row < count; row++)
+    results[row] = func(invoke_arg<TArgs>(std::get<Is>(cols)[row])...);
+}
+
+template<typename... TArgs, typename F, typename TResults, std::size_t... Is>
+void batch_invoke_columns(F& func, void* const* columns, size_t count, TResults results, std::index_sequence<Is...> seq) {
+  // typed columns pointers are resolved once, loop body is plain indexed access and direct call
+  std::tuple<batch_column_type<TArgs>...> cols(static_cast<batch_column_type<TArgs> >(columns[Is])...);
+  (void)columns;
+  if (results)
+    batch_invoke_rows<TArgs...>(func, cols, count, results, seq, std::integral_constant<bool,
+      !std::is_void<typename std::remove_pointer<TResults>::type>::value>{});
+  else
+    batch_invoke_rows<TArgs...>(func, cols, count, results, seq, std::false_type{});
+}
+
+/// \brief    Call func for each row of columnar arguments. Results are stored to results array if it is not null
+template<typename... TArgs, typename F, typename TResults>
+void batch_invoke(F&& func, void* const* columns, size_t count, TResults results) {
+  batch_invoke_columns<TArgs...>(func, columns, count, results, std::make_index_sequence<sizeof...(TArgs)>{});
+}
+
+// direct call can't report error by return value
+[[noreturn]] inline void direct_call_failed(const char* message) {
+#if DELEGATES_TRACE
+  std::cerr << message << std::endl;
+#endif //DELEGATES_TRACE
+  DELEGATES_THROW(std::runtime_error(message));
+}
+
+// report call with null class pointer
+inline bool null_callee_failed() {
+#if DELEGATES_TRACE
+  std::cerr << "Delegate call failed: Class pointer is null" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+  throw std::runtime_error("Delegate call failed: Class pointer is null");
+#endif //DELEGATES_STRICT
+
+  return false;
+}
+
+/// \brief    Callable stored by value, which may be replaced with another one of the same type.
+///           Assignable callables are kept as plain member and replaced by assignment
+template<typename TFunc, bool = std::is_copy_assignable<TFunc>::value && std::is_move_assignable<TFunc>::value>
+class CallableHolder {
+ public:
+  template<typename G>
+  explicit CallableHolder(G&& value) : func_(std::forward<G>(value)) {}
+
+  TFunc& get() noexcept { return func_; }
+
+  template<typename G>
+  void rebind(G&& value) {
+    static_assert(std::is_constructible<TFunc, G&&>::value, "Callable of the same type is required for rebind");
+    func_ = std::forward<G>(value);
+  }
+
+ private:
+  TFunc func_;
+};
+
+/// \brief    Lambdas are not assignable: callable is kept in raw storage and accessed by pointer returned from
+///           placement new, so it may be destroyed and constructed again (object with const or reference members
+///           can't be accessed by old name after that without std::launder)
+template<typename TFunc>
+class CallableHolder<TFunc, false> {
+ public:
+  template<typename G>
+  explicit CallableHolder(G&& value) : func_(new (&storage_) TFunc(std::forward<G>(value))) {}
+
+  ~CallableHolder() { func_->~TFunc(); }
+
+  TFunc& get() noexcept { return *func_; }
+
+  // new callable is constructed aside first, so throwing copy leaves old one intact,
+  // then old callable is destroyed and new one is moved to its place
+  template<typename G>
+  void rebind(G&& value) {
+    static_assert(std::is_constructible<TFunc, G&&>::value, "Callable of the same type is required for rebind");
+    static_assert(std::is_nothrow_move_constructible<TFunc>::value, "Callable must be nothrow move constructible to be rebound");
+    TFunc tmp(std::forward<G>(value));
+    func_->~TFunc();
+    func_ = new (&storage_) TFunc(std::move(tmp));
+  }
+
+ private:
+  CallableHolder(const CallableHolder&) = delete;
+  CallableHolder& operator=(const CallableHolder&) = delete;
+
+  typename std::aligned_storage<sizeof(TFunc), alignof(TFunc)>::type storage_;
+  TFunc* func_;
+};
+
 /// \brief    Delegate base implementation. Void or non-void return types are supported
 template<typename TResult, typename... TArgs>
 struct DelegateBase
-  : public virtual IDelegate {
+  : public virtual IDelegate
+  , public IDelegateInvoke<TResult, TArgs...> {
   DelegateBase(DelegateArgs<TArgs...> && params) : params_(std::move(params)) {}
 #if DELEGATES_LIFETIME_GUARD
   ~DelegateBase() {
@@ -99,6 +268,18 @@ struct DelegateBase
   ~DelegateBase() = default;
 #endif
 
+#if DELEGATES_RECYCLER
+  static void* operator new(size_t size) { return DelegateRecycler::allocate(size); }
+  static void operator delete(void* p, size_t size) noexcept { DelegateRecycler::deallocate(p, size); }
+#if defined(__cpp_aligned_new)
+  // over-aligned delegates are not recycled
+  static void* operator new(size_t size, std::align_val_t alignment) { return ::operator new(size, alignment); }
+  static void operator delete(void* p, size_t size, std::align_val_t alignment) noexcept {
+    ::operator delete(p, size, alignment);
+  }
+#endif //__cpp_aligned_new
+#endif //DELEGATES_RECYCLER
+
   bool call() override {
 #if DELEGATES_LIFETIME_GUARD
     if (guard_ != DELEGATES_GUARD_ALIVE)
@@ -108,42 +289,118 @@ struct DelegateBase
   }
   
   bool call(IDelegateArgs* args) override { 
-    if (!args || args->size() != params_.size()) {
+    if (!args) {
 #if DELEGATES_TRACE
-      std::cerr << "Null or wrong arguments count provided to call()" << std::endl;
+      std::cerr << "Null arguments provided to call()" << std::endl;
 #endif //DELEGATES_TRACE
 
 #if DELEGATES_STRICT
-      throw std::runtime_error("Null or wrong arguments count provided to call()");
+      throw std::runtime_error("Null arguments provided to call()");
 #endif //DELEGATES_STRICT
 
       return false;
     }
-    for (size_t i = 0; i < params_.size(); i++) {
-      if (args->hash_code(i) != params_.hash_code(i)) {
+    // arguments count and all types are checked by single fingerprint compare
+    if (args->signature() != signature_id<TArgs...>()) {
 #if DELEGATES_TRACE
-        std::cerr << "Wrong argument type provided to call, argument number " << i << std::endl;
+      std::cerr << "Wrong arguments count or types provided to call()" << std::endl;
 #endif //DELEGATES_TRACE
 
 #if DELEGATES_STRICT
-        throw std::runtime_error("Wrong argument type provided to call");
+      throw std::runtime_error("Wrong arguments count or types provided to call()");
 #endif //DELEGATES_STRICT
 
-        return false;
-      }
+      return false;
     }
 
     return perform_call(result_, *static_cast<DelegateArgs<TArgs...>*>(args)); 
   }
+
+  bool call(IDelegateCallFrame& frame) override {
+#if DELEGATES_LIFETIME_GUARD
+    if (guard_ != DELEGATES_GUARD_ALIVE)
+      DELEGATES_GUARD_FAULT(0xDEAD0002);
+#endif
+    if (frame.frame_type() != type_id<DelegateCallFrame<TResult, TArgs...> >()) {
+#if DELEGATES_TRACE
+      std::cerr << "Wrong call frame type provided to call()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Wrong call frame type provided to call()");
+#endif //DELEGATES_STRICT
+
+      return false;
+    }
+
+    // delegate arguments and result are not touched here, but call target is: concurrent calls with different
+    // frames are safe only when target is (e.g. no mutable lambda state, no rebind() during call)
+    auto& typed_frame = static_cast<DelegateCallFrame<TResult, TArgs...>&>(frame);
+    return perform_call(typed_frame.typed_result(), typed_frame.typed_args());
+  }
   IDelegateResult* result() override { return static_cast<IDelegateResult*>(&result_); }
   IDelegateArgs* args() override { return static_cast<IDelegateArgs*>(&params_); }
+  void reset() override {
+    params_.clear();
+    result_.clear();
+  }
+
+  bool call_batch_ptr(void* const* columns, size_t signature, size_t const_columns, size_t count,
+    void* results, size_t result_type) override {
+#if DELEGATES_LIFETIME_GUARD
+    if (guard_ != DELEGATES_GUARD_ALIVE)
+      DELEGATES_GUARD_FAULT(0xDEAD0002);
+#endif
+    // all checks are done once for whole batch
+    if (signature != signature_id<TArgs...>() || (sizeof...(TArgs) && !columns) ||
+      (const_columns & batch_mutable_columns<TArgs...>())) {
+#if DELEGATES_TRACE
+      std::cerr << "Wrong arguments columns provided to call_batch()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Wrong arguments columns provided to call_batch()");
+#endif //DELEGATES_STRICT
+
+      return false;
+    }
+
+    if (results && (std::is_void<TResult>::value || result_type != type_id<TResult>())) {
+#if DELEGATES_TRACE
+      std::cerr << "Wrong results type provided to call_batch()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Wrong results type provided to call_batch()");
+#endif //DELEGATES_STRICT
+
+      return false;
+    }
+
+    if (!count)
+      return true;
+
+    return perform_batch(columns, count, static_cast<batch_results_type<TResult> >(results));
+  }
+
+  void* query_invoke(size_t invoke_type) override {
+    if (invoke_type != type_id<IDelegateInvoke<TResult, TArgs...> >())
+      return nullptr;
+    return static_cast<IDelegateInvoke<TResult, TArgs...>*>(this);
+  }
+
+  DelegateRefCount* ref_count() override { return &ref_count_; }
 
 protected:
   // perform_call must be implemented by nested classes
   virtual bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args) = 0;
+
+  // perform_batch must be implemented by nested classes: call target for each row using detail::batch_invoke()
+  virtual bool perform_batch(void* const* columns, size_t count, batch_results_type<TResult> results) = 0;
 private:
   DelegateResult<TResult> result_;
   DelegateArgs<TArgs...> params_;
+  DelegateRefCount ref_count_;
 #if DELEGATES_LIFETIME_GUARD
   uint64_t guard_ = DELEGATES_GUARD_ALIVE;
 #endif
@@ -169,6 +426,11 @@ public:
 
     for (const auto& c : shared_calls_)
       delegates.push_back(c.call_.get());
+
+    if (handle_calls_) {
+      for (const auto& c : *handle_calls_)
+        delegates.push_back(c.call_.get());
+    }
   }
 
   virtual bool call() override {
@@ -177,27 +439,127 @@ public:
 
   virtual bool call(IDelegateArgs* args) override {
     std::list<SharedDelegateType> shared_calls;
+    std::shared_ptr<const HandleCalls> handle_calls;
     std::list<DelegateType> calls;
 
     {
       std::lock_guard<std::mutex> lock(mutex_);
       shared_calls = shared_calls_;
+      handle_calls = handle_calls_;
       calls = calls_;
     }
 
     bool result = true;
 
+    // signal arguments fingerprint is queried once, slots fingerprints are cached when slots are added
+    IDelegateArgs* pargs = args ? args : &params_;
+    size_t args_signature = pargs->signature();
+
     for(const auto& c : calls)
-      result &= perform_call(c.call_, args, c.args_mode_);
+      result &= perform_call(c.call_, pargs, args_signature, c.signature_, c.args_mode_);
 
     for(const auto& c : shared_calls)
-      result &= perform_call(c.call_.get(), args, c.args_mode_);
+      result &= perform_call(c.call_.get(), pargs, args_signature, c.signature_, c.args_mode_);
+
+    if (handle_calls) {
+      for (const auto& c : *handle_calls)
+        result &= perform_call(c.call_.get(), pargs, args_signature, c.signature_, c.args_mode_);
+    }
 
     return result;
   }
 
   IDelegateResult* result() override { return static_cast<IDelegateResult*>(&result_); }
   IDelegateArgs* args() override { return static_cast<IDelegateArgs*>(&params_); }
+  void reset() override {
+    params_.clear();
+    result_.clear();
+  }
+
+  bool call_batch_ptr(void* const* columns, size_t signature, size_t const_columns, size_t count,
+    void* results, size_t result_type) override {
+    if (signature != signature_id<TArgs...>() || (results && result_type != type_id<TResult>())) {
+#if DELEGATES_TRACE
+      std::cerr << "Wrong arguments or results types provided to call_batch()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Wrong arguments or results types provided to call_batch()");
+#endif //DELEGATES_STRICT
+
+      return false;
+    }
+
+    std::list<SharedDelegateType> shared_calls;
+    std::shared_ptr<const HandleCalls> handle_calls;
+    std::list<DelegateType> calls;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shared_calls = shared_calls_;
+      handle_calls = handle_calls_;
+      calls = calls_;
+    }
+
+    bool result = true;
+
+    for (const auto& c : calls)
+      result &= perform_batch(c.call_, c.signature_, c.args_mode_, columns, signature, const_columns, count, results);
+
+    for (const auto& c : shared_calls)
+      result &= perform_batch(c.call_.get(), c.signature_, c.args_mode_, columns, signature, const_columns, count, results);
+
+    if (handle_calls) {
+      for (const auto& c : *handle_calls)
+        result &= perform_batch(c.call_.get(), c.signature_, c.args_mode_, columns, signature, const_columns, count, results);
+    }
+
+    return result;
+  }
+
+  // signal has no single target to call directly
+  void* query_invoke(size_t) override { return nullptr; }
+
+  // frame is passed to each delegate, so all delegates must have exactly the same types as signal
+  bool call(IDelegateCallFrame& frame) override {
+    if (frame.frame_type() != type_id<DelegateCallFrame<TResult, TArgs...> >()) {
+#if DELEGATES_TRACE
+      std::cerr << "Wrong call frame type provided to call()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Wrong call frame type provided to call()");
+#endif //DELEGATES_STRICT
+
+      return false;
+    }
+
+    std::list<SharedDelegateType> shared_calls;
+    std::shared_ptr<const HandleCalls> handle_calls;
+    std::list<DelegateType> calls;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shared_calls = shared_calls_;
+      handle_calls = handle_calls_;
+      calls = calls_;
+    }
+
+    bool result = true;
+
+    for (const auto& c : calls)
+      result &= c.call_->call(frame);
+
+    for (const auto& c : shared_calls)
+      result &= c.call_->call(frame);
+
+    if (handle_calls) {
+      for (const auto& c : *handle_calls)
+        result &= c.call_->call(frame);
+    }
+
+    return result;
+  }
 
   virtual void add(
     IDelegate* call,
@@ -221,6 +583,7 @@ public:
     c.deleter_ = deleter;
     c.tag_ = tag;
     c.args_mode_ = args_mode;
+    c.signature_ = call->args()->signature();
 
     std::lock_guard<std::mutex> lock(mutex_);
     calls_.push_back(c);
@@ -242,11 +605,37 @@ public:
     c.call_ = call;
     c.tag_ = tag;
     c.args_mode_ = args_mode;
+    c.signature_ = call->args()->signature();
 
     std::lock_guard<std::mutex> lock(mutex_);
     shared_calls_.push_back(c);
   }
 
+  virtual void add(DelegateHandle call, const std::string& tag = std::string(), DelegateArgsMode args_mode = kDelegateArgsMode_Auto) override {
+    if (!call) {
+#if DELEGATES_TRACE
+      std::cerr << "Null delegate provided to add()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Null delegate provided to add()");
+#endif //DELEGATES_STRICT
+      return;
+    }
+
+    HandleDelegateType c;
+    c.signature_ = call->args()->signature();
+    c.call_ = std::move(call);
+    c.tag_ = tag;
+    c.args_mode_ = args_mode;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_ptr<HandleCalls> handle_calls = handle_calls_ ?
+      std::make_shared<HandleCalls>(*handle_calls_) : std::make_shared<HandleCalls>();
+    handle_calls->push_back(std::move(c));
+    handle_calls_ = std::move(handle_calls);
+  }
+
   virtual void remove(const std::string& tag) override {
     std::lock_guard<std::mutex> lock(mutex_);
     calls_.remove_if([&tag](const DelegateType& c) {
@@ -261,6 +650,8 @@ public:
     shared_calls_.remove_if([&tag](const SharedDelegateType& c) {
       return c.tag_ == tag;
     });
+
+    remove_handle_calls([&tag](const HandleDelegateType& c) { return c.tag_ == tag; });
   }
 
   virtual void remove(IDelegate* call) override {
@@ -302,6 +693,22 @@ public:
     shared_calls_.remove_if([&call](const SharedDelegateType& c) { return c.call_ == call; });
   }
 
+  virtual void remove(const DelegateHandle& call) override {
+    if (!call) {
+#if DELEGATES_TRACE
+      std::cerr << "Null delegate provided to remove()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Null delegate provided to remove()");
+#endif //DELEGATES_STRICT
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    remove_handle_calls([&call](const HandleDelegateType& c) { return c.call_ == call; });
+  }
+
   virtual void remove_all() override {
     std::lock_guard<std::mutex> lock(mutex_);
     calls_.remove_if([](DelegateType& c) {
@@ -311,33 +718,25 @@ public:
     });
 
     shared_calls_.clear();
+    handle_calls_.reset();
   }
 
+  DelegateRefCount* ref_count() override { return &ref_count_; }
+
  private:
   // check the arguments are correspond between signal and delegate when args_mode == kDelegateArgsMode_UseSignalArgs
-  static bool check_delegate_arguments_correspond_to_signal(IDelegate* call, IDelegateArgs* args) {
-    if (call->args()->size() == 0)
-      return true;
-
-    if (args->size() != call->args()->size())
-      return false;
-
-    for (size_t i = 0; i < args->size(); i++) {
-      if (args->hash_code(i) != call->args()->hash_code(i))
-        return false;
-    }
-
-    return true;
+  static bool check_delegate_arguments_correspond_to_signal(size_t call_signature, size_t args_signature) {
+    return call_signature == signature_id<>() || call_signature == args_signature;
   }
 
   // Execute call: check types, pass args to call, execute call, move result
-  bool perform_call(IDelegate* call, IDelegateArgs* args, DelegateArgsMode args_mode) {
+  bool perform_call(IDelegate* call, IDelegateArgs* pargs, size_t args_signature, size_t call_signature, DelegateArgsMode args_mode) {
     using result_noref = typename std::decay<TResult>::type;
 
-    if (call->result()->hash_code() != typeid(TResult).hash_code() && call->result()->hash_code() != typeid(void).hash_code()) {
+    if (call->result()->hash_code() != type_id<TResult>() && call->result()->hash_code() != type_id<void>()) {
 #if DELEGATES_TRACE
       std::cerr << "[DELEGATE ERROR] Cannot perform call for delegate because return type is incompatible";
-      std::cerr << "  delegate result type: " << typeid(TResult).name() << ", hash code " << typeid(TResult).hash_code();
+      std::cerr << "  delegate result type hash code " << type_id<TResult>();
       std::cerr << ", call result hash code " << call->result()->hash_code() << std::endl;
 #endif //DELEGATES_TRACE
 
@@ -353,8 +752,7 @@ public:
       ret = call->call();
     }
     else {
-      IDelegateArgs* pargs = args ? args : &params_;
-      bool use_args = check_delegate_arguments_correspond_to_signal(call, pargs);
+      bool use_args = check_delegate_arguments_correspond_to_signal(call_signature, args_signature);
 
       if (args_mode == kDelegateArgsMode_Auto) {
         if (!use_args)
@@ -365,7 +763,7 @@ public:
       }
 
       if (use_args && args_mode == kDelegateArgsMode_UseSignalArgs) {
-        if (call->args()->size() == 0)
+        if (call_signature == signature_id<>())
           ret = call->call();
         else
           ret = call->call(pargs);
@@ -382,30 +780,98 @@ public:
 #endif //DELEGATES_STRICT
     }
 
-    if (!ret || call->result()->hash_code() == typeid(void).hash_code())
+    if (!ret || call->result()->hash_code() == type_id<void>())
       return ret;
 
     return MoveDelegateResult<TResult>{}(call->result(), result());
   }
 
+  // Execute batch call for one slot: slots taking signal arguments are called over columns and write results
+  // (the last such slot wins, like for single call), slots with own arguments are called once per row
+  // with stored arguments, so their stored result is overwritten (see IDelegate::call_batch_ptr())
+  bool perform_batch(IDelegate* call, size_t call_signature, DelegateArgsMode args_mode,
+    void* const* columns, size_t signature, size_t const_columns, size_t count, void* results) {
+    size_t call_result_type = call->result()->hash_code();
+    if (call_result_type != type_id<TResult>() && call_result_type != type_id<void>()) {
+#if DELEGATES_TRACE
+      std::cerr << "[DELEGATE ERROR] Cannot perform batch call for delegate because return type is incompatible" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Cannot perform batch call for delegate because return type is incompatible");
+#endif // DELEGATES_STRICT
+      return false;
+    }
+
+    if (args_mode != kDelegateArgsMode_UseDelegateOwnArgs && call_signature == signature) {
+      void* call_results = call_result_type == type_id<void>() ? nullptr : results;
+      return call->call_batch_ptr(columns, signature, const_columns, count, call_results, call_result_type);
+    }
+
+    if (args_mode == kDelegateArgsMode_UseSignalArgs) {
+#if DELEGATES_TRACE
+      std::cerr << "Call was not performed" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Call was not performed");
+#endif //DELEGATES_STRICT
+      return false;
+    }
+
+    bool ret = true;
+    for (size_t row = 0; row < count; row++)
+      ret &= call->call();
+    return ret;
+  }
+
   struct SharedDelegateType {
     std::shared_ptr<IDelegate> call_;
     std::string tag_;
     DelegateArgsMode args_mode_ = kDelegateArgsMode_Auto;
+    size_t signature_ = 0;  // delegate arguments fingerprint, cached when delegate is added
+  };
+
+  struct HandleDelegateType {
+    DelegateHandle call_;
+    std::string tag_;
+    DelegateArgsMode args_mode_ = kDelegateArgsMode_Auto;
+    size_t signature_ = 0;  // delegate arguments fingerprint, cached when delegate is added
   };
 
+  // handle slots are immutable snapshot replaced by add() and remove() (copy-on-write),
+  // so calls share it under lock without copying slots
+  using HandleCalls = std::vector<HandleDelegateType>;
+
+  // replace handle slots by copy without slots matching pred, called under lock
+  template<typename TPred>
+  void remove_handle_calls(TPred pred) {
+    if (!handle_calls_ || std::none_of(handle_calls_->begin(), handle_calls_->end(), pred))
+      return;
+
+    std::shared_ptr<HandleCalls> handle_calls = std::make_shared<HandleCalls>();
+    for (const auto& c : *handle_calls_) {
+      if (!pred(c))
+        handle_calls->push_back(c);
+    }
+    handle_calls_ = std::move(handle_calls);
+  }
+
   struct DelegateType {
     IDelegate* call_ = nullptr;
     std::function<void(IDelegate*)> deleter_ = [](IDelegate*){};
     std::string tag_;
     DelegateArgsMode args_mode_ = kDelegateArgsMode_Auto;
+    size_t signature_ = 0;  // delegate arguments fingerprint, cached when delegate is added
   };
 
   DelegateResult<TResult> result_;
   DelegateArgs<TArgs...> params_;
   std::list<SharedDelegateType> shared_calls_;
+  std::shared_ptr<const HandleCalls> handle_calls_;
   std::list<DelegateType> calls_;
   mutable std::mutex mutex_;
+  DelegateRefCount ref_count_;
 };
 
 }//namespace detail
@@ -430,7 +896,35 @@ class MethodDelegate
 
   ~MethodDelegate() = default;
 
+  /// \brief    Point delegate to another object and method. Stored arguments and result are kept
+  void rebind(TClass* owner, TResult (TClass::* member)(TArgs...)) {
+    callee_ = owner;
+    method_ = member;
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(TClass* owner) { callee_ = owner; }
+
+  TResult invoke(TArgs... args) override {
+    auto callee = callee_;
+    if (!callee)
+      direct_call_failed("Delegate call failed: Class pointer is null");
+    return (callee->*method_)(std::forward<TArgs>(args)...);
+  }
+
  private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<TResult> results) override {
+    auto callee = callee_;
+    if (!callee)
+      return null_callee_failed();
+
+    auto method = method_;
+    batch_invoke<TArgs...>([callee, method](auto&&... args) -> decltype(auto) {
+      return (callee->*method)(std::forward<decltype(args)>(args)...);
+    }, columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args) override {
     return perform_call(result, args, std::make_index_sequence<sizeof...(TArgs)>{});
   }
@@ -450,7 +944,7 @@ class MethodDelegate
       return false;
     }
 
-    result.set((callee->*(method_))(std::get<Is>(args.get_tuple())...));
+    result.set((callee->*(method_))(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...));
     return true;
   }
 };
@@ -468,7 +962,35 @@ class ConstMethodDelegate
 
   ~ConstMethodDelegate() = default;
 
+  /// \brief    Point delegate to another object and method. Stored arguments and result are kept
+  void rebind(const TClass* owner, TResult(TClass::* member)(TArgs...) const) {
+    callee_ = owner;
+    method_ = member;
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(const TClass* owner) { callee_ = owner; }
+
+  TResult invoke(TArgs... args) override {
+    auto callee = callee_;
+    if (!callee)
+      direct_call_failed("Delegate call failed: Class pointer is null");
+    return (callee->*method_)(std::forward<TArgs>(args)...);
+  }
+
  private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<TResult> results) override {
+    auto callee = callee_;
+    if (!callee)
+      return null_callee_failed();
+
+    auto method = method_;
+    batch_invoke<TArgs...>([callee, method](auto&&... args) -> decltype(auto) {
+      return (callee->*method)(std::forward<decltype(args)>(args)...);
+    }, columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args) override {
     return perform_call(result, args, std::make_index_sequence<sizeof...(TArgs)>{});
   }
@@ -488,7 +1010,7 @@ class ConstMethodDelegate
       return false;
     }
 
-    result.set((callee->*(method_))(std::get<Is>(args.get_tuple())...));
+    result.set((callee->*(method_))(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...));
     return true;
   }
 
@@ -510,7 +1032,35 @@ public:
 
   ~ConstMethodDelegate() = default;
 
+  /// \brief    Point delegate to another object and method. Stored arguments are kept
+  void rebind(const TClass* owner, void(TClass::* member)(TArgs...) const) {
+    callee_ = owner;
+    method_ = member;
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(const TClass* owner) { callee_ = owner; }
+
+  void invoke(TArgs... args) override {
+    auto callee = callee_;
+    if (!callee)
+      direct_call_failed("Delegate call failed: Class pointer is null");
+    return (callee->*method_)(std::forward<TArgs>(args)...);
+  }
+
 private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<void> results) override {
+    auto callee = callee_;
+    if (!callee)
+      return null_callee_failed();
+
+    auto method = method_;
+    batch_invoke<TArgs...>([callee, method](auto&&... args) -> decltype(auto) {
+      return (callee->*method)(std::forward<decltype(args)>(args)...);
+    }, columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<void>&, DelegateArgs<TArgs...>& args) override {
     return perform_call(args, std::make_index_sequence<sizeof...(TArgs)>{});
   }
@@ -530,7 +1080,7 @@ private:
       return false;
     }
 
-    (callee->*(method_))(std::get<Is>(args.get_tuple())...);
+    (callee->*(method_))(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...);
     return true;
   }
 
@@ -552,7 +1102,35 @@ class MethodDelegate<TClass, void, TArgs...>
 
   ~MethodDelegate() = default;
 
+  /// \brief    Point delegate to another object and method. Stored arguments are kept
+  void rebind(TClass* owner, void (TClass::* member)(TArgs...)) {
+    callee_ = owner;
+    method_ = member;
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(TClass* owner) { callee_ = owner; }
+
+  void invoke(TArgs... args) override {
+    auto callee = callee_;
+    if (!callee)
+      direct_call_failed("Delegate call failed: Class pointer is null");
+    return (callee->*method_)(std::forward<TArgs>(args)...);
+  }
+
  private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<void> results) override {
+    auto callee = callee_;
+    if (!callee)
+      return null_callee_failed();
+
+    auto method = method_;
+    batch_invoke<TArgs...>([callee, method](auto&&... args) -> decltype(auto) {
+      return (callee->*method)(std::forward<decltype(args)>(args)...);
+    }, columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<void>&, DelegateArgs<TArgs...>& args) override {
     return perform_call(args, std::make_index_sequence<sizeof...(TArgs)>{});
   }
@@ -571,7 +1149,7 @@ class MethodDelegate<TClass, void, TArgs...>
       return false;
     }
 
-    (callee->*(method_))(std::get<Is>(args.get_tuple())...);
+    (callee->*(method_))(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...);
     return true;
   }
 
@@ -581,6 +1159,99 @@ class MethodDelegate<TClass, void, TArgs...>
 };
 
 
+namespace detail {
+
+/// \brief    Class method deferred call with method bound at compile time. Method is not stored in delegate and
+///           its call may be inlined into perform_call. Both void and non-void result types are supported
+template <typename TCallee, typename TMethod, TMethod TMember, typename TResult, typename... TArgs>
+class BoundMethodDelegateImpl
+  : public DelegateBase<TResult, TArgs...> {
+ public:
+  BoundMethodDelegateImpl(TCallee owner, DelegateArgs<TArgs...>&& params)
+    :DelegateBase<TResult, TArgs...>(std::move(params))
+    , callee_(owner) {}
+
+  /// \brief    Point delegate to another object. Stored arguments and result are kept
+  void rebind(TCallee owner) { callee_ = owner; }
+
+  TResult invoke(TArgs... args) override {
+    auto callee = callee_;
+    if (!callee)
+      direct_call_failed("Delegate call failed: Class pointer is null");
+    return (callee->*TMember)(std::forward<TArgs>(args)...);
+  }
+
+ private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<TResult> results) override {
+    auto callee = callee_;
+    if (!callee)
+      return null_callee_failed();
+
+    batch_invoke<TArgs...>([callee](auto&&... args) -> decltype(auto) {
+      return (callee->*TMember)(std::forward<decltype(args)>(args)...);
+    }, columns, count, results);
+    return true;
+  }
+
+  bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args) override {
+    auto callee = callee_;
+    if (!callee)
+      return null_callee_failed();
+
+    perform_call(callee, result, args, std::make_index_sequence<sizeof...(TArgs)>{}, std::is_void<TResult>{});
+    return true;
+  }
+
+  template <std::size_t... Is>
+  void perform_call(TCallee callee, DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args,
+    std::index_sequence<Is...>, std::false_type) {
+    result.set((callee->*TMember)(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...));
+  }
+
+  template <std::size_t... Is>
+  void perform_call(TCallee callee, DelegateResult<TResult>&, DelegateArgs<TArgs...>& args,
+    std::index_sequence<Is...>, std::true_type) {
+    (callee->*TMember)(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...);
+  }
+
+  TCallee callee_;
+};
+
+}//namespace detail
+
+
+/// \brief    Class method deferred call with method passed as template parameter:
+///           BoundMethodDelegate<decltype(&TClass::Method), &TClass::Method>
+template <typename TMethod, TMethod TMember>
+class BoundMethodDelegate;
+
+/// \brief    Compile-time bound class method delegate
+template <class TClass, typename TResult, typename... TArgs, TResult (TClass::*TMember)(TArgs...)>
+class BoundMethodDelegate<TResult (TClass::*)(TArgs...), TMember>
+  : public detail::BoundMethodDelegateImpl<TClass*, TResult (TClass::*)(TArgs...), TMember, TResult, TArgs...> {
+ public:
+  typedef TClass* callee_type;
+  typedef DelegateArgs<TArgs...> args_type;
+
+  BoundMethodDelegate(TClass* owner, DelegateArgs<TArgs...>&& params)
+    :detail::BoundMethodDelegateImpl<TClass*, TResult (TClass::*)(TArgs...), TMember, TResult, TArgs...>(
+      owner, std::move(params)) {}
+};
+
+/// \brief    Compile-time bound class const method delegate
+template <class TClass, typename TResult, typename... TArgs, TResult (TClass::*TMember)(TArgs...) const>
+class BoundMethodDelegate<TResult (TClass::*)(TArgs...) const, TMember>
+  : public detail::BoundMethodDelegateImpl<const TClass*, TResult (TClass::*)(TArgs...) const, TMember, TResult, TArgs...> {
+ public:
+  typedef const TClass* callee_type;
+  typedef DelegateArgs<TArgs...> args_type;
+
+  BoundMethodDelegate(const TClass* owner, DelegateArgs<TArgs...>&& params)
+    :detail::BoundMethodDelegateImpl<const TClass*, TResult (TClass::*)(TArgs...) const, TMember, TResult, TArgs...>(
+      owner, std::move(params)) {}
+};
+
+
 /// \brief    Functional delegate implementation for all result types but void
 template <typename TResult, typename... TArgs>
 class FunctionalDelegate
@@ -592,14 +1263,27 @@ public:
   }
 
   ~FunctionalDelegate() override = default;
+
+  /// \brief    Replace called function. Stored arguments and result are kept
+  void rebind(std::function<TResult(TArgs...)> func) { func_ = std::move(func); }
+
+  TResult invoke(TArgs... args) override {
+    return func_(std::forward<TArgs>(args)...);
+  }
+
 private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<TResult> results) override {
+    batch_invoke<TArgs...>(func_, columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args) override {
     return perform_call(result, args, std::make_index_sequence<sizeof...(TArgs)>{});
   }
 
   template <std::size_t... Is>
   bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args, std::index_sequence<Is...>) {
-    result.set(func_(std::get<Is>(args.get_tuple())...));
+    result.set(func_(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...));
     return true;
   }
 
@@ -618,7 +1302,20 @@ class FunctionalDelegate<void, TArgs...>
   }
 
   ~FunctionalDelegate() = default;
+
+  /// \brief    Replace called function. Stored arguments are kept
+  void rebind(std::function<void(TArgs...)> func) { func_ = std::move(func); }
+
+  void invoke(TArgs... args) override {
+    return func_(std::forward<TArgs>(args)...);
+  }
+
 private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<void> results) override {
+    batch_invoke<TArgs...>(func_, columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<void>&, DelegateArgs<TArgs...>& args) override {
     perform_call(args, std::make_index_sequence<sizeof...(TArgs)>{});
     return true;
@@ -626,7 +1323,7 @@ private:
 
   template<std::size_t... Is>
   void perform_call(DelegateArgs<TArgs...>& args, std::index_sequence<Is...>) {
-    func_(std::get<Is>(args.get_tuple())...);
+    func_(invoke_arg<TArgs>(std::get<Is>(args.get_tuple()))...);
   }
 
   std::function<void(TArgs...)> func_;
@@ -634,18 +1331,33 @@ private:
 
 
 /// \brief    Lambda delegate implementation for non-void result types
+///           Callable is stored by value inside the delegate and called directly, without std::function
 template <typename TResult, typename F, typename... TArgs>
 class LambdaDelegate
   : public detail::DelegateBase<TResult,TArgs...> {
 public:
   LambdaDelegate(F&& lambda, DelegateArgs<TArgs...> && params)
-    :func_(std::function<TResult(TArgs...)>(std::move(lambda)))
-    , detail::DelegateBase<TResult, TArgs...>(std::move(params)) {
+    : detail::DelegateBase<TResult, TArgs...>(std::move(params))
+    , func_(std::forward<F>(lambda)) {
   }
 
   ~LambdaDelegate() override = default;
 
+  /// \brief    Replace stored callable with another one of the same type, e.g. the same lambda with other captures.
+  ///           Stored arguments and result are kept
+  template<typename G>
+  void rebind(G&& lambda) { func_.rebind(std::forward<G>(lambda)); }
+
+  TResult invoke(TArgs... args) override {
+    return func_.get()(std::forward<TArgs>(args)...);
+  }
+
 private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<TResult> results) override {
+    batch_invoke<TArgs...>(func_.get(), columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args) override {
     result.set(perform_function_call(args.get_tuple(), std::make_index_sequence<sizeof...(TArgs)>{}));
     return true;
@@ -653,26 +1365,41 @@ private:
 
   template <std::size_t... Is>
   TResult perform_function_call(typename std::tuple<TArgs&...>& tup, std::index_sequence<Is...>) {
-    return func_(std::get<Is>(tup)...);
+    return func_.get()(invoke_arg<TArgs>(std::get<Is>(tup))...);
   }
 
-  std::function<TResult(TArgs...)> func_;
+  CallableHolder<typename std::decay<F>::type> func_;
 };
 
 
 /// \brief    Lambda delegate implementation for void result type
+///           Callable is stored by value inside the delegate and called directly, without std::function
 template <typename F, typename... TArgs>
 class LambdaDelegate<void, F, TArgs...>
   : public detail::DelegateBase<void, TArgs...> {
 public:
   LambdaDelegate(F&& lambda, DelegateArgs<TArgs...>&& params)
-    :func_(std::function<void(TArgs...)>(std::move(lambda)))
-    , detail::DelegateBase<void, TArgs...>(std::move(params)) {
+    : detail::DelegateBase<void, TArgs...>(std::move(params))
+    , func_(std::forward<F>(lambda)) {
   }
 
   ~LambdaDelegate() override = default;
 
+  /// \brief    Replace stored callable with another one of the same type, e.g. the same lambda with other captures.
+  ///           Stored arguments and result are kept
+  template<typename G>
+  void rebind(G&& lambda) { func_.rebind(std::forward<G>(lambda)); }
+
+  void invoke(TArgs... args) override {
+    func_.get()(std::forward<TArgs>(args)...);
+  }
+
 private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<void> results) override {
+    batch_invoke<TArgs...>(func_.get(), columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<void>&, DelegateArgs<TArgs...>& args) override {
     perform_function_call(args.get_tuple(), std::make_index_sequence<sizeof...(TArgs)>{});
     return true;
@@ -680,10 +1407,10 @@ private:
 
   template <std::size_t... Is>
   void perform_function_call(typename std::tuple<TArgs&...>& tup, std::index_sequence<Is...>) {
-    func_(std::get<Is>(tup)...);
+    func_.get()(invoke_arg<TArgs>(std::get<Is>(tup))...);
   }
 
-  std::function<void(TArgs...)> func_;
+  CallableHolder<typename std::decay<F>::type> func_;
 };
 
 
@@ -698,6 +1425,19 @@ class SharedMethodDelegate
     , callee_ptr_(callee) {}
 
   ~SharedMethodDelegate() = default;
+
+  /// \brief    Point delegate to another object and method, ownership of previous object is released
+  void rebind(std::shared_ptr<TClass> callee, TResult(TClass::* method)(TArgs...)) {
+    MethodDelegate<TClass, TResult, TArgs...>::rebind(callee.get(), method);
+    callee_ptr_ = std::move(callee);
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(std::shared_ptr<TClass> callee) {
+    MethodDelegate<TClass, TResult, TArgs...>::rebind(callee.get());
+    callee_ptr_ = std::move(callee);
+  }
+
  private:
   std::shared_ptr<TClass> callee_ptr_;
 };
@@ -714,6 +1454,19 @@ public:
     , callee_ptr_(callee) {}
 
   ~SharedConstMethodDelegate() = default;
+
+  /// \brief    Point delegate to another object and method, ownership of previous object is released
+  void rebind(std::shared_ptr<TClass> callee, TResult(TClass::* method)(TArgs...) const) {
+    ConstMethodDelegate<TClass, TResult, TArgs...>::rebind(callee.get(), method);
+    callee_ptr_ = std::move(callee);
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(std::shared_ptr<TClass> callee) {
+    ConstMethodDelegate<TClass, TResult, TArgs...>::rebind(callee.get());
+    callee_ptr_ = std::move(callee);
+  }
+
 private:
   std::shared_ptr<TClass> callee_ptr_;
 };
@@ -730,7 +1483,42 @@ class WeakMethodDelegate
     ,method_(method) {}
 
   ~WeakMethodDelegate() = default;
+
+  /// \brief    Point delegate to another object and method. Stored arguments and result are kept
+  void rebind(std::weak_ptr<TClass> callee, TResult(TClass::* method)(TArgs...)) {
+    callee_ = std::move(callee);
+    method_ = method;
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(std::weak_ptr<TClass> callee) { callee_ = std::move(callee); }
+
+  TResult invoke(TArgs... args) override {
+    auto callee = callee_.lock();
+    if (!callee)
+      direct_call_failed("Delegate call failed: weak pointer is null");
+    return (callee.get()->*method_)(std::forward<TArgs>(args)...);
+  }
+
  private:
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<TResult> results) override {
+    // object is locked once for whole batch
+    auto callee = callee_.lock();
+    if (!callee) {
+#if DELEGATES_TRACE
+      std::cerr << "WARNING: Delegate was not called: weak pointer is null" << std::endl;
+#endif //DELEGATES_TRACE
+      return false;
+    }
+
+    TClass* ptr = callee.get();
+    auto method = method_;
+    batch_invoke<TArgs...>([ptr, method](auto&&... args) -> decltype(auto) {
+      return (ptr->*method)(std::forward<decltype(args)>(args)...);
+    }, columns, count, results);
+    return true;
+  }
+
   bool perform_call(DelegateResult<TResult>& result, DelegateArgs<TArgs...>& args) override {
     return perform_call(result, args.get_tuple(), std::make_index_sequence<sizeof...(TArgs)>{});
   }
@@ -744,7 +1532,7 @@ class WeakMethodDelegate
 #endif //DELEGATES_TRACE
       return false;
     }
-    result.set((callee.get()->*(method_))(std::get<Is>(tup)...));
+    result.set((callee.get()->*(method_))(invoke_arg<TArgs>(std::get<Is>(tup))...));
     return true;
   }
 
@@ -765,6 +1553,23 @@ class WeakMethodDelegate<TClass,void,TArgs...>
     ,method_(method) {}
 
   ~WeakMethodDelegate() = default;
+
+  /// \brief    Point delegate to another object and method. Stored arguments are kept
+  void rebind(std::weak_ptr<TClass> callee, void(TClass::*method)(TArgs...)) {
+    callee_ = std::move(callee);
+    method_ = method;
+  }
+
+  /// \brief    Point delegate to another object, method is kept
+  void rebind(std::weak_ptr<TClass> callee) { callee_ = std::move(callee); }
+
+  void invoke(TArgs... args) override {
+    auto callee = callee_.lock();
+    if (!callee)
+      direct_call_failed("Delegate call failed: weak pointer is null");
+    return (callee.get()->*method_)(std::forward<TArgs>(args)...);
+  }
+
  private:
   template <std::size_t... Is>
   bool perform_call(std::tuple<TArgs...>& tup, std::index_sequence<Is...>) {
@@ -776,7 +1581,25 @@ class WeakMethodDelegate<TClass,void,TArgs...>
 
       return false;
     }
-    (callee.get()->*(method_))(std::get<Is>(tup)...);
+    (callee.get()->*(method_))(invoke_arg<TArgs>(std::get<Is>(tup))...);
+    return true;
+  }
+
+  bool perform_batch(void* const* columns, size_t count, batch_results_type<void> results) override {
+    // object is locked once for whole batch
+    auto callee = callee_.lock();
+    if (!callee) {
+#if DELEGATES_TRACE
+      std::cerr << "WARNING: Delegate was not called: weak pointer is null" << std::endl;
+#endif //DELEGATES_TRACE
+      return false;
+    }
+
+    TClass* ptr = callee.get();
+    auto method = method_;
+    batch_invoke<TArgs...>([ptr, method](auto&&... args) -> decltype(auto) {
+      return (ptr->*method)(std::forward<decltype(args)>(args)...);
+    }, columns, count, results);
     return true;
   }
 
@@ -0,0 +1,206 @@
+//
+// Copyright (c) 2025, Alex Bobryshev <alexbobryshev555@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DELEGATES_DELEGATE_POOL_HEADER
+#define DELEGATES_DELEGATE_POOL_HEADER
+
+#include "../delegates_conf.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+DELEGATES_BASE_NAMESPACE_BEGIN
+
+namespace delegates {
+
+/// \brief    Memory pool tuned for delegates allocation.
+///           Requests up to kMaxBlockSize bytes are rounded up to size class (multiple of kGranularity),
+///           each size class has its own free list. Blocks are carved from chunks and never returned to system
+///           until pool is destroyed, freed blocks are reused by next allocations of the same size class.
+///           Larger or over-aligned requests are passed to global operator new (aligned as requested).
+///           Pool is thread-safe. Pool must outlive all objects allocated from it
+class DelegatePool {
+ public:
+  static constexpr size_t kGranularity = 16;
+  static constexpr size_t kMaxBlockSize = 512;
+  static constexpr size_t kSizeClasses = kMaxBlockSize / kGranularity;
+
+  /// \brief    Create pool
+  /// \param    blocks_per_chunk - how many blocks are allocated at once when size class free list is empty
+  explicit DelegatePool(size_t blocks_per_chunk = 64) noexcept
+    : blocks_per_chunk_(blocks_per_chunk ? blocks_per_chunk : 1) {}
+
+  ~DelegatePool() {
+    for (void* chunk : chunks_)
+      ::operator delete(chunk);
+  }
+
+  /// \brief    Allocate memory block
+  /// \param    size - block size in bytes
+  /// \param    alignment - required alignment
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    if (!pooled(size, alignment))
+      return allocate_unpooled(size, alignment);
+
+    size_t cls = size_class(size);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!free_[cls])
+      grow(cls);
+
+    FreeBlock* block = free_[cls];
+    free_[cls] = block->next_;
+    return block;
+  }
+
+  /// \brief    Return memory block to pool
+  /// \param    p - block returned by allocate()
+  /// \param    size - the same size as passed to allocate()
+  /// \param    alignment - the same alignment as passed to allocate()
+  void deallocate(void* p, size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+    if (!p)
+      return;
+
+    if (!pooled(size, alignment)) {
+      deallocate_unpooled(p, size, alignment);
+      return;
+    }
+
+    size_t cls = size_class(size);
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    std::lock_guard<std::mutex> lock(mutex_);
+    block->next_ = free_[cls];
+    free_[cls] = block;
+  }
+
+  /// \brief    Process-wide pool used by DelegatePoolAllocator by default
+  static DelegatePool& default_pool() {
+    static DelegatePool pool;
+    return pool;
+  }
+
+ private:
+  DelegatePool(const DelegatePool&) = delete;
+  DelegatePool& operator=(const DelegatePool&) = delete;
+
+  struct FreeBlock {
+    FreeBlock* next_;
+  };
+
+  // blocks are carved from chunks at kGranularity steps, chunk itself has default operator new alignment
+  static bool pooled(size_t size, size_t alignment) {
+    return size && size <= kMaxBlockSize && alignment <= kGranularity && alignment <= alignof(std::max_align_t);
+  }
+
+  static void* allocate_unpooled(size_t size, size_t alignment) {
+    if (alignment <= alignof(std::max_align_t))
+      return ::operator new(size);
+#if defined(__cpp_aligned_new)
+    return ::operator new(size, std::align_val_t(alignment));
+#else
+    // block is over-allocated and aligned manually, pointer to allocated memory is kept right before aligned block
+    void* raw = ::operator new(size + alignment + sizeof(void*));
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + sizeof(void*) + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<void*>(aligned);
+#endif
+  }
+
+  static void deallocate_unpooled(void* p, size_t size, size_t alignment) noexcept {
+    (void)size;
+    if (alignment <= alignof(std::max_align_t)) {
+      ::operator delete(p);
+      return;
+    }
+#if defined(__cpp_aligned_new)
+    ::operator delete(p, std::align_val_t(alignment));
+#else
+    ::operator delete(static_cast<void**>(p)[-1]);
+#endif
+  }
+
+  static size_t size_class(size_t size) {
+    return (size - 1) / kGranularity;
+  }
+
+  // allocate new chunk for size class and put its blocks to free list. Called under lock
+  void grow(size_t cls) {
+    size_t block_size = (cls + 1) * kGranularity;
+    char* chunk = static_cast<char*>(::operator new(block_size * blocks_per_chunk_));
+    chunks_.push_back(chunk);
+
+    for (size_t i = 0; i < blocks_per_chunk_; i++) {
+      FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + i * block_size);
+      block->next_ = free_[cls];
+      free_[cls] = block;
+    }
+  }
+
+  size_t blocks_per_chunk_;
+  std::mutex mutex_;
+  FreeBlock* free_[kSizeClasses] = {};
+  std::vector<void*> chunks_;
+};
+
+/// \brief    Standard allocator over DelegatePool. Used with factory::allocate_shared() and std::allocate_shared
+template<typename T>
+class DelegatePoolAllocator {
+ public:
+  using value_type = T;
+
+  DelegatePoolAllocator() noexcept : pool_(&DelegatePool::default_pool()) {}
+  explicit DelegatePoolAllocator(DelegatePool& pool) noexcept : pool_(&pool) {}
+
+  template<typename U>
+  DelegatePoolAllocator(const DelegatePoolAllocator<U>& other) noexcept : pool_(other.pool()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(pool_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* p, size_t n) noexcept {
+    pool_->deallocate(p, n * sizeof(T), alignof(T));
+  }
+
+  DelegatePool* pool() const noexcept { return pool_; }
+
+ private:
+  DelegatePool* pool_;
+};
+
+template<typename T, typename U>
+bool operator==(const DelegatePoolAllocator<T>& a, const DelegatePoolAllocator<U>& b) noexcept {
+  return a.pool() == b.pool();
+}
+
+template<typename T, typename U>
+bool operator!=(const DelegatePoolAllocator<T>& a, const DelegatePoolAllocator<U>& b) noexcept {
+  return a.pool() != b.pool();
+}
+
+}//namespace delegates
+
+DELEGATES_BASE_NAMESPACE_END
+
+#endif //DELEGATES_DELEGATE_POOL_HEADER
@@ -0,0 +1,221 @@
+//
+// Copyright (c) 2025, Alex Bobryshev <alexbobryshev555@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DELEGATES_DELEGATE_RECYCLER_HEADER
+#define DELEGATES_DELEGATE_RECYCLER_HEADER
+
+#include "../delegates_conf.h"
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+// Recycler of delegate objects memory. When enabled, delegates created by plain new (factory::make,
+// make_unique and so on) are allocated by class operator new of DelegateBase from DelegateRecycler:
+// freed delegates go to free list of the freeing thread and are reused by next delegates of the same
+// size class. Producer/consumer pattern (delegates are created in one thread and destroyed in another)
+// is served by batches: thread which frees more than it allocates passes full batches of blocks to
+// shared depot, thread which allocates more takes them back, so malloc/free are not called in steady state.
+// Memory of recycled blocks is never returned to system.
+//
+// Shared delegates created by std::make_shared or allocate_shared are not affected.
+#ifndef DELEGATES_RECYCLER
+#define DELEGATES_RECYCLER 0
+#endif
+
+DELEGATES_BASE_NAMESPACE_BEGIN
+
+namespace delegates {
+
+/// \brief    Per-thread recycler of delegate objects memory.
+///           Requests up to kMaxBlockSize bytes are rounded up to size class (multiple of kGranularity),
+///           each thread has own free list per size class, so allocation and deallocation take no locks.
+///           Blocks are passed between threads by batches of kBatchSize through shared depot (single lock per batch).
+///           Larger or over-aligned requests are passed to global operator new.
+class DelegateRecycler {
+ public:
+  static constexpr size_t kGranularity = 16;
+  static constexpr size_t kMaxBlockSize = 512;
+  static constexpr size_t kSizeClasses = kMaxBlockSize / kGranularity;
+  static constexpr size_t kBatchSize = 32;
+  static constexpr size_t kMaxThreadBlocks = 2 * kBatchSize;  // per size class
+
+  /// \brief    Allocate memory block
+  /// \param    size - block size in bytes
+  static void* allocate(size_t size) {
+    if (!recycled(size))
+      return ::operator new(size);
+
+    size_t cls = size_class(size);
+    ThreadCache* cache = thread_cache();
+    if (!cache || (!cache->free_[cls] && !depot().take(cls, *cache)))
+      return ::operator new(block_size(cls));
+
+    FreeBlock* block = cache->free_[cls];
+    cache->free_[cls] = block->next_;
+    cache->count_[cls]--;
+    return block;
+  }
+
+  /// \brief    Return memory block for reuse. May be called from any thread
+  /// \param    p - block returned by allocate()
+  /// \param    size - the same size as passed to allocate()
+  static void deallocate(void* p, size_t size) noexcept {
+    if (!p)
+      return;
+
+    if (!recycled(size)) {
+      ::operator delete(p);
+      return;
+    }
+
+    // thread cache is already destroyed when delegate is freed by later thread_local destructor
+    ThreadCache* cache = thread_cache();
+    if (!cache) {
+      ::operator delete(p);
+      return;
+    }
+
+    size_t cls = size_class(size);
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    block->next_ = cache->free_[cls];
+    cache->free_[cls] = block;
+    if (++cache->count_[cls] > kMaxThreadBlocks)
+      depot().put(cls, *cache, kBatchSize);
+  }
+
+  /// \brief    Get count of blocks cached by current thread for size class of size
+  static size_t thread_cached(size_t size) {
+    ThreadCache* cache = recycled(size) ? thread_cache() : nullptr;
+    return cache ? cache->count_[size_class(size)] : 0;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next_;
+    FreeBlock* next_batch_;  // used by first block of batch stored in depot
+  };
+  static_assert(sizeof(FreeBlock) <= kGranularity, "free block links must fit into smallest block");
+
+  struct ThreadCache {
+    FreeBlock* free_[kSizeClasses] = {};
+    size_t count_[kSizeClasses] = {};
+
+    ThreadCache() = default;
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+
+    // cached blocks of exiting thread are passed to other threads
+    ~ThreadCache() {
+      thread_cache_destroyed() = true;
+      for (size_t cls = 0; cls < kSizeClasses; cls++) {
+        if (count_[cls])
+          depot().put(cls, *this, count_[cls]);
+      }
+    }
+  };
+
+  // batches of free blocks shared between threads, batches are linked through their first blocks,
+  // so depot never allocates and put() can be called from noexcept deallocate()
+  class Depot {
+   public:
+    // move first count blocks of thread free list to depot as single batch
+    void put(size_t cls, ThreadCache& cache, size_t count) noexcept {
+      FreeBlock* head = cache.free_[cls];
+      FreeBlock* tail = head;
+      for (size_t i = 1; i < count; i++)
+        tail = tail->next_;
+
+      cache.free_[cls] = tail->next_;
+      cache.count_[cls] -= count;
+      tail->next_ = nullptr;
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      head->next_batch_ = batches_[cls];
+      batches_[cls] = head;
+    }
+
+    // move one batch to empty thread free list
+    bool take(size_t cls, ThreadCache& cache) {
+      FreeBlock* head;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        head = batches_[cls];
+        if (!head)
+          return false;
+        batches_[cls] = head->next_batch_;
+      }
+
+      // batch is owned by this thread now, its size is counted out of lock
+      size_t count = 0;
+      for (FreeBlock* block = head; block; block = block->next_)
+        count++;
+      cache.free_[cls] = head;
+      cache.count_[cls] = count;
+      return true;
+    }
+
+   private:
+    std::mutex mutex_;
+    FreeBlock* batches_[kSizeClasses] = {};
+  };
+
+  static bool recycled(size_t size) {
+    return size && size <= kMaxBlockSize;
+  }
+
+  static size_t size_class(size_t size) {
+    return (size - 1) / kGranularity;
+  }
+
+  static size_t block_size(size_t cls) {
+    return (cls + 1) * kGranularity;
+  }
+
+  // depot is never destroyed: threads may exit after static objects destruction.
+  // It is placed in static storage, so first use from thread cache destructor does not allocate
+  static Depot& depot() noexcept {
+    alignas(Depot) static unsigned char storage[sizeof(Depot)];
+    static Depot* instance = new (storage) Depot();
+    return *instance;
+  }
+
+  // trivially destructible flag stays valid until thread exit, after destruction of thread cache
+  static bool& thread_cache_destroyed() noexcept {
+    static thread_local bool destroyed = false;
+    return destroyed;
+  }
+
+  // nullptr if thread cache is destroyed, blocks are passed to global operator new/delete then
+  static ThreadCache* thread_cache() noexcept {
+    if (thread_cache_destroyed())
+      return nullptr;
+    static thread_local ThreadCache cache;
+    return &cache;
+  }
+};
+
+}//namespace delegates
+
+DELEGATES_BASE_NAMESPACE_END
+
+#endif //DELEGATES_DELEGATE_RECYCLER_HEADER
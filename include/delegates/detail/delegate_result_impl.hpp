@@ -33,111 +33,191 @@
 #include <list>
 #include <mutex>
 #include <cstddef>
+#include <new>
+#include <type_traits>
 
 DELEGATES_BASE_NAMESPACE_BEGIN
 
 namespace delegates {
 namespace detail {
 
-/// \brief    Result for all copyable types but void
+/// \brief    Result for all types but void
+///           Value is kept in raw aligned storage: it is constructed only when set and destroyed on clear(),
+///           so result type does not need default constructor. Move-only types are supported, for them
+///           copying set_ptr() fails and copyable() returns false
 template <typename TValue>
 class DelegateResult 
   : public virtual IDelegateResult {
+  using value_type = typename std::decay<TValue>::type;
+  static_assert(!is_unnamed_type<TValue>::value, "Closure types can't be delegate result: their type_id() is not unique");
+
  public:
   DelegateResult()
-      : default_value_(), value_(default_value_), has_value_(false) {
-    static_assert(std::is_same<TValue,void>::value || std::is_copy_constructible<TValue>::value, "Result type must be copyable");
-  }
+      : has_value_(false) {}
 
   virtual ~DelegateResult() override { clear(); }
 
   size_t hash_code() const override {
-    return typeid(TValue).hash_code();
+    return type_id<TValue>();
   }
 
-  bool set_ptr(const void* value_ptr, size_t type_hash, std::function<void(void*)> deleter_ptr = [](void* ptr) {}) override {
-    using value_noconst = typename std::decay<TValue>::type;
+  bool set_ptr(const void* value_ptr, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override {
+    clear();
+    if (!value_ptr) // ptr==null means just clear stored value
+      return true;
+
+    if (!check_type(type_hash))
+      return false;
+
+    if (!copy_construct(value_ptr, std::is_copy_constructible<value_type>()))
+      return false;
+
+    deleter_ = std::move(deleter);
+    has_value_ = true;
+    return true;
+  }
 
+  bool set_move_ptr(void* value_ptr, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override {
     clear();
     if (!value_ptr) // ptr==null means just clear stored value
       return true;
 
-    if (hash_code() != type_hash) {
+    if (!check_type(type_hash))
+      return false;
+
+    new (&storage_) value_type(std::move(*reinterpret_cast<value_type*>(value_ptr)));
+    deleter_ = std::move(deleter);
+    has_value_ = true;
+    return true;
+  }
+
+  bool detach_ptr(void* value_ptr, size_t value_size, DelegateDeleter& deleter) override {
+    if (!has_value_) {
 #if DELEGATES_TRACE
-      std::cerr << "Delegate result was not set: value type hash code is not the same as result type" << std::endl;
+      std::cerr << "WARNING Delegate result was not detached: has no value" << std::endl;
+#endif //DELEGATES_TRACE
+      return false;
+    }
+
+    if (value_size != std::numeric_limits<size_t>::max() && value_size != sizeof(value_type)) {
+#if DELEGATES_TRACE
+      std::cerr << "Delegate result was not detached: value size is not the same" << std::endl;
 #endif //DELEGATES_TRACE
 
 #if DELEGATES_STRICT
-      throw std::runtime_error("Delegate result was not set: value type hash code is not the same as result type");
+      throw std::runtime_error("Delegate result was not detached: value size is not the same");
 #endif //DELEGATES_STRICT
 
       return false;
     }
 
-    const value_noconst* pv = reinterpret_cast<const value_noconst*>(value_ptr);
-    value_ = *pv;
-    deleter_ptr_ = deleter_ptr;
-    has_value_ = true;
+    value_type* v = reinterpret_cast<value_type*>(value_ptr);
+    *v = std::move(value());
+    deleter = std::move(deleter_);
+    destroy();
     return true;
   }
 
-  bool detach_ptr(void* value_ptr, size_t value_size, std::function<void(void*)>& deleter_ptr) override {
-    using value_noconst = typename std::decay<TValue>::type;
-
+  bool move_to(IDelegateResult* to) override {
     if (!has_value_) {
 #if DELEGATES_TRACE
-      std::cerr << "WARNING Delegate result was not detached: has no value" << std::endl;
+      std::cerr << "WARNING Delegate result was not moved: has no value" << std::endl;
 #endif //DELEGATES_TRACE
       return false;
     }
 
-    if (value_size != std::numeric_limits<size_t>::max() && value_size != sizeof(value_)) {
+    if (!to || to->hash_code() != hash_code()) {
 #if DELEGATES_TRACE
-      std::cerr << "Delegate result was not detached: value size is not the same" << std::endl;
+      std::cerr << "Delegate result was not moved: destination result type is not the same" << std::endl;
 #endif //DELEGATES_TRACE
 
 #if DELEGATES_STRICT
-      throw std::runtime_error("Delegate result was not detached: value size is not the same");
+      throw std::runtime_error("Delegate result was not moved: destination result type is not the same");
 #endif //DELEGATES_STRICT
 
       return false;
     }
 
-    value_noconst* v = reinterpret_cast<value_noconst*>(value_ptr);
-    *v = value_;
-    deleter_ptr = deleter_ptr_;
-    value_ = default_value_;
-    has_value_ = false;
-    deleter_ptr_ = [](void*) {};
-    return true;
+    // deleter ownership goes to destination together with value, so value is destroyed here without deleter call
+    bool ret = to->set_move_ptr(&value(), hash_code(), std::move(deleter_));
+    destroy();
+    return ret;
   }
 
   void clear() override {
     if (has_value_) {
-      if (deleter_ptr_)
-        deleter_ptr_(reinterpret_cast<void*>(&value_));
+      if (deleter_)
+        deleter_(reinterpret_cast<void*>(&value()));
 
-      value_ = default_value_;
-      has_value_ = false;
+      destroy();
     }
   }
 
+  void release() override {
+    if (has_value_)
+      destroy();
+  }
+
+  bool copyable() const override { return std::is_copy_constructible<value_type>::value; }
+  DelegateCompletion* completion() override { return &completion_; }
+
   bool has_value() const override { return has_value_; }
   void* get_ptr() override {
-    return has_value_ ? reinterpret_cast<void*>(&value_) : nullptr;
+    return has_value_ ? reinterpret_cast<void*>(&storage_) : nullptr;
   }
-  const void* get_ptr() const override { return has_value_ ? &value_ : nullptr; }
-  int size_bytes() const override { return sizeof(value_); }
+  const void* get_ptr() const override { return has_value_ ? reinterpret_cast<const void*>(&storage_) : nullptr; }
+  int size_bytes() const override { return sizeof(value_type); }
 
  private:
   // copying is prohibited because DelegateResult owns stored value (deleter may be called for it)
   DelegateResult(const DelegateResult&) {}
   DelegateResult& operator= (const DelegateResult& other) { return *this; }
    
-  typename std::decay<TValue>::type default_value_;
-  typename std::decay<TValue>::type value_;
+  typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type storage_;
   bool has_value_;
-  std::function<void(void*)> deleter_ptr_ = [](void*) {};
+  DelegateDeleter deleter_;
+  DelegateCompletion completion_;
+
+  value_type& value() { return *reinterpret_cast<value_type*>(&storage_); }
+
+  bool copy_construct(const void* value_ptr, std::true_type) {
+    new (&storage_) value_type(*reinterpret_cast<const value_type*>(value_ptr));
+    return true;
+  }
+
+  bool copy_construct(const void* value_ptr, std::false_type) {
+    (void)value_ptr;
+#if DELEGATES_TRACE
+    std::cerr << "Delegate result was not set: result type is move-only, copy is not possible" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+    throw std::runtime_error("Delegate result was not set: result type is move-only, copy is not possible");
+#endif //DELEGATES_STRICT
+
+    return false;
+  }
+
+  void destroy() {
+    value().~value_type();
+    has_value_ = false;
+    deleter_.reset();
+  }
+
+  bool check_type(size_t type_hash) const {
+    if (hash_code() == type_hash)
+      return true;
+
+#if DELEGATES_TRACE
+    std::cerr << "Delegate result was not set: value type hash code is not the same as result type" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+    throw std::runtime_error("Delegate result was not set: value type hash code is not the same as result type");
+#endif //DELEGATES_STRICT
+
+    return false;
+  }
 };
 
 /// \brief    Delegate result for 'void' type
@@ -147,10 +227,10 @@ class DelegateResult<void>
  public:
   ~DelegateResult() override = default;
 
-  bool set_ptr(const void* value_ptr, size_t type_hash, std::function<void(void*)> deleter_ptr = [](void*) {}) override { 
+  bool set_ptr(const void* value_ptr, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override { 
     (void)value_ptr;
     (void)type_hash;
-    (void)deleter_ptr;
+    (void)deleter;
 #if DELEGATES_TRACE
     std::cerr << "Delegate result set() called for void result" << std::endl;
 #endif //DELEGATES_TRACE
@@ -161,10 +241,13 @@ class DelegateResult<void>
 
     return false; 
   }
-  bool detach_ptr(void* value_ptr, size_t value_size, std::function<void(void*)>& deleter_ptr) override { 
+  bool set_move_ptr(void* value_ptr, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) override { 
+    return set_ptr(value_ptr, type_hash, std::move(deleter));
+  }
+  bool detach_ptr(void* value_ptr, size_t value_size, DelegateDeleter& deleter) override { 
     (void)value_ptr;
     (void)value_size;
-    (void)deleter_ptr;
+    (void)deleter;
 #if DELEGATES_TRACE
     std::cerr << "Delegate result detach() called for void result" << std::endl;
 #endif //DELEGATES_TRACE
@@ -175,24 +258,27 @@ class DelegateResult<void>
 
     return false; 
   }
+  bool move_to(IDelegateResult* to) override { (void)to; return false; }
+  void release() override {}
+  bool copyable() const override { return true; }
+  DelegateCompletion* completion() override { return &completion_; }
   bool has_value() const override { return false; }
   void* get_ptr() override { return nullptr; }
   const void* get_ptr() const override { return nullptr; }
   int size_bytes() const override { return 0; }
-  size_t hash_code() const override { return typeid(void).hash_code(); }
+  size_t hash_code() const override { return type_id<void>(); }
   void clear() override {}
+
+ private:
+  DelegateCompletion completion_;
 };
 
-/// \brief    Move delegate result for non-void types
+/// \brief    Move delegate result for non-void types. Value and its deleter are moved, no copies are made
 template<typename TResult>
 struct MoveDelegateResult {
   bool operator()(IDelegateResult* from, IDelegateResult* to) {
-    using result_noref = typename std::decay<TResult>::type;
-    result_noref ret_val;
-    std::function<void(void*)> deleter;
-    if (from->detach_ptr(&ret_val, sizeof(ret_val), deleter)) {
-      return to->set_ptr(&ret_val, typeid(TResult).hash_code(), deleter);
-    }
+    if (from->move_to(to))
+      return true;
 
 #if DELEGATES_TRACE
     std::cerr << "Move delegate result failed" << std::endl;
@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2025, Alex Bobryshev <alexbobryshev555@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DELEGATES_DELEGATE_WAIT_HEADER
+#define DELEGATES_DELEGATE_WAIT_HEADER
+
+#include "../delegates_conf.h"
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__cpp_lib_atomic_wait)
+// std::atomic::wait() and notify_all() are used
+#elif defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#if defined(_MSC_VER)
+#pragma comment(lib, "Synchronization.lib")
+#endif
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+DELEGATES_BASE_NAMESPACE_BEGIN
+
+namespace delegates {
+
+namespace detail {
+
+// Blocking wait on 32-bit atomic value without per-object kernel objects: thread is parked while value is equal
+// to expected and woken up by atomic_notify_all(). Spurious wake ups are possible, caller must check value again.
+// Implemented by std::atomic::wait() in C++20, futex(2) on Linux, WaitOnAddress() on Windows,
+// and shared table of condition variables elsewhere
+#if defined(__cpp_lib_atomic_wait)
+
+inline void atomic_wait_value(const std::atomic<uint32_t>& value, uint32_t expected) noexcept {
+  value.wait(expected, std::memory_order_acquire);
+}
+
+inline void atomic_notify_all(std::atomic<uint32_t>& value) noexcept {
+  value.notify_all();
+}
+
+#elif defined(__linux__)
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex requires plain 32-bit atomic");
+
+inline void atomic_wait_value(const std::atomic<uint32_t>& value, uint32_t expected) noexcept {
+  // returns immediately with EAGAIN if value is already changed, EINTR is handled by caller loop
+  syscall(SYS_futex, reinterpret_cast<const uint32_t*>(&value), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+inline void atomic_notify_all(std::atomic<uint32_t>& value) noexcept {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(&value), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+}
+
+#elif defined(_WIN32)
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "WaitOnAddress requires plain 32-bit atomic");
+
+inline void atomic_wait_value(const std::atomic<uint32_t>& value, uint32_t expected) noexcept {
+  WaitOnAddress(const_cast<std::atomic<uint32_t>*>(&value), &expected, sizeof(expected), INFINITE);
+}
+
+inline void atomic_notify_all(std::atomic<uint32_t>& value) noexcept {
+  WakeByAddressAll(&value);
+}
+
+#else
+
+struct AtomicWaitSlot {
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+// waiters are spread by address over fixed table, so no wait state is stored in waited objects
+inline AtomicWaitSlot& atomic_wait_slot(const void* address) noexcept {
+  static AtomicWaitSlot slots[16];
+  return slots[(reinterpret_cast<uintptr_t>(address) >> 4) % 16];
+}
+
+inline void atomic_wait_value(const std::atomic<uint32_t>& value, uint32_t expected) noexcept {
+  AtomicWaitSlot& slot = atomic_wait_slot(&value);
+  std::unique_lock<std::mutex> lock(slot.mutex_);
+  // value is checked under slot lock and notifier takes the same lock, so wake up can't be lost
+  while (value.load(std::memory_order_acquire) == expected)
+    slot.cv_.wait(lock);
+}
+
+inline void atomic_notify_all(std::atomic<uint32_t>& value) noexcept {
+  AtomicWaitSlot& slot = atomic_wait_slot(&value);
+  std::lock_guard<std::mutex> lock(slot.mutex_);
+  slot.cv_.notify_all();
+}
+
+#endif
+
+}//namespace detail
+
+}//namespace delegates
+
+DELEGATES_BASE_NAMESPACE_END
+
+#endif //DELEGATES_DELEGATE_WAIT_HEADER
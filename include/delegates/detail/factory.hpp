@@ -26,6 +26,7 @@
 #include "delegate_impl.hpp"
 #include "function_traits.hpp"
 #include "callable_traits.hpp"
+#include "delegate_pool.hpp"
 #include "../typed_delegate.hpp"
 #include <memory>
 
@@ -459,6 +460,133 @@ static std::unique_ptr<ISignal> make_unique_signal(DelegateArgs<TArgs...> && par
   return std::make_unique<detail::SignalBase<TResult,TArgs...> >(std::move(params));
 }
 
+// allocator-aware shared
+// Delegate (with its arguments, result and deleters storage) and shared_ptr control block are allocated
+// by single allocation from user allocator, e.g. DelegatePoolAllocator
+
+template <typename TAlloc, typename TResult, typename... TArgs, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, TResult f(TArgs...), TArgs... args) {
+  return std::allocate_shared<FunctionalDelegate<TResult, TArgs...> >(alloc,
+    std::function<TResult(TArgs...)>(f), DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TAlloc, typename TResult, typename... TArgs>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, TResult f(TArgs...), DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<FunctionalDelegate<TResult, TArgs...> >(alloc,
+    std::function<TResult(TArgs...)>(f), std::move(params));
+}
+
+template <typename TAlloc, typename TResult, typename... TArgs, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, std::function<TResult(TArgs...)> func, TArgs... args) {
+  return std::allocate_shared<FunctionalDelegate<TResult, TArgs...> >(alloc, func, DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TAlloc, typename TResult, typename... TArgs>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, std::function<TResult(TArgs...)> func, DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<FunctionalDelegate<TResult, TArgs...> >(alloc, func, std::move(params));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, TClass* callee, TResult (TClass::*method)(TArgs...), TArgs... args) {
+  return std::allocate_shared<MethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, TClass* callee, TResult (TClass::*method)(TArgs...), DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<MethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, std::move(params));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, std::shared_ptr<TClass> callee, TResult (TClass::*method)(TArgs...), TArgs... args) {
+  return std::allocate_shared<SharedMethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, std::shared_ptr<TClass> callee, TResult (TClass::*method)(TArgs...), DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<SharedMethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, std::move(params));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, const TClass* callee, TResult(TClass::* method)(TArgs...) const, TArgs... args) {
+  return std::allocate_shared<ConstMethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, const TClass* callee, TResult(TClass::* method)(TArgs...) const, DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<ConstMethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, std::move(params));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, std::shared_ptr<TClass> callee, TResult(TClass::* method)(TArgs...) const, TArgs... args) {
+  return std::allocate_shared<SharedConstMethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TAlloc, typename TClass, typename TResult, typename... TArgs>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, std::shared_ptr<TClass> callee, TResult(TClass::* method)(TArgs...) const, DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<SharedConstMethodDelegate<TClass, TResult, TArgs...> >(alloc, callee, method, std::move(params));
+}
+
+template <typename TResult=void, typename... TArgs, typename TAlloc, typename F, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, F && lambda, TArgs&&... args) {
+  return std::allocate_shared<LambdaDelegate<TResult, F, TArgs...> >(alloc, std::move(lambda), DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TResult=void, typename... TArgs, typename TAlloc, typename F>
+static std::shared_ptr<IDelegate> allocate_shared(const TAlloc& alloc, F&& lambda, DelegateArgs<TArgs...>&& params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<LambdaDelegate<TResult, F, TArgs...> >(alloc, std::move(lambda), std::move(params));
+}
+
+template <typename TResult=void, typename... TArgs, typename TAlloc, bool TCheck=true, typename = typename std::enable_if<sizeof...(TArgs) && TCheck>::type>
+static std::shared_ptr<ISignal> allocate_shared_signal(const TAlloc& alloc, TArgs&&... args) {
+  return std::allocate_shared<detail::SignalBase<TResult, TArgs...> >(alloc, DelegateArgs<TArgs...>(std::forward<TArgs>(args)...));
+}
+
+template <typename TResult=void, typename... TArgs, typename TAlloc>
+static std::shared_ptr<ISignal> allocate_shared_signal(const TAlloc& alloc, DelegateArgs<TArgs...> && params = DelegateArgs<TArgs...>()) {
+  return std::allocate_shared<detail::SignalBase<TResult, TArgs...> >(alloc, std::move(params));
+}
+
+// compile-time bound methods
+// Method is template parameter, so it is not stored in delegate and its call may be inlined:
+//   make_bound_method_delegate<decltype(&TClass::Method), &TClass::Method>(callee, args...)
+// or with C++17: make<&TClass::Method>(callee, args...)
+// Arguments may be passed as values or as single DelegateArgs<...> object
+
+template <typename TMethod, TMethod TMember, typename... TCallArgs>
+static IDelegate* make_bound_method_delegate(typename BoundMethodDelegate<TMethod, TMember>::callee_type callee, TCallArgs&&... args) {
+  return new BoundMethodDelegate<TMethod, TMember>(callee,
+    typename BoundMethodDelegate<TMethod, TMember>::args_type(std::forward<TCallArgs>(args)...));
+}
+
+template <typename TMethod, TMethod TMember, typename... TCallArgs>
+static std::shared_ptr<IDelegate> make_shared_bound_method_delegate(typename BoundMethodDelegate<TMethod, TMember>::callee_type callee, TCallArgs&&... args) {
+  return std::make_shared<BoundMethodDelegate<TMethod, TMember> >(callee,
+    typename BoundMethodDelegate<TMethod, TMember>::args_type(std::forward<TCallArgs>(args)...));
+}
+
+template <typename TMethod, TMethod TMember, typename... TCallArgs>
+static std::unique_ptr<IDelegate> make_unique_bound_method_delegate(typename BoundMethodDelegate<TMethod, TMember>::callee_type callee, TCallArgs&&... args) {
+  return std::make_unique<BoundMethodDelegate<TMethod, TMember> >(callee,
+    typename BoundMethodDelegate<TMethod, TMember>::args_type(std::forward<TCallArgs>(args)...));
+}
+
+#if defined(__cpp_nontype_template_parameter_auto)
+template <auto TMember, typename... TCallArgs>
+static IDelegate* make(typename BoundMethodDelegate<decltype(TMember), TMember>::callee_type callee, TCallArgs&&... args) {
+  return make_bound_method_delegate<decltype(TMember), TMember>(callee, std::forward<TCallArgs>(args)...);
+}
+
+template <auto TMember, typename... TCallArgs>
+static std::shared_ptr<IDelegate> make_shared(typename BoundMethodDelegate<decltype(TMember), TMember>::callee_type callee, TCallArgs&&... args) {
+  return make_shared_bound_method_delegate<decltype(TMember), TMember>(callee, std::forward<TCallArgs>(args)...);
+}
+
+template <auto TMember, typename... TCallArgs>
+static std::unique_ptr<IDelegate> make_unique(typename BoundMethodDelegate<decltype(TMember), TMember>::callee_type callee, TCallArgs&&... args) {
+  return make_unique_bound_method_delegate<decltype(TMember), TMember>(callee, std::forward<TCallArgs>(args)...);
+}
+#endif //__cpp_nontype_template_parameter_auto
+
 // ============================================================================
 // New unified API with automatic type deduction
 // ============================================================================
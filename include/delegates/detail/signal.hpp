@@ -60,6 +60,10 @@ struct Signal : public virtual ISignal {
     return delegate_->call(args);
   }
 
+  bool call(IDelegateCallFrame& frame) override {
+    return delegate_->call(frame);
+  }
+
   IDelegateArgs* args() override {
     return delegate_->args();
   }
@@ -68,6 +72,19 @@ struct Signal : public virtual ISignal {
     return delegate_->result();
   }
 
+  void reset() override {
+    delegate_->reset();
+  }
+
+  bool call_batch_ptr(void* const* columns, size_t signature, size_t const_columns, size_t count,
+    void* results, size_t result_type) override {
+    return delegate_->call_batch_ptr(columns, signature, const_columns, count, results, result_type);
+  }
+
+  void* query_invoke(size_t invoke_type) override {
+    return delegate_->query_invoke(invoke_type);
+  }
+
   bool operator()() {
     return delegate_->call();
   }
@@ -82,6 +99,16 @@ struct Signal : public virtual ISignal {
     return *this;
   }
 
+  Signal& operator +=(DelegateHandle delegate) {
+    add(std::move(delegate));
+    return *this;
+  }
+
+  Signal& operator -=(const DelegateHandle& delegate) {
+    remove(delegate);
+    return *this;
+  }
+
   Signal& operator +=(IDelegate* delegate) {
     add(delegate);
     return *this;
@@ -152,6 +179,24 @@ struct Signal : public virtual ISignal {
     delegate_->add(delegate, tag, args_mode);
   }
 
+  void add(
+    DelegateHandle delegate,
+    const std::string& tag = std::string(),
+    DelegateArgsMode args_mode = kDelegateArgsMode_Auto) override {
+    if (!delegate) {
+#if DELEGATES_TRACE
+      std::cerr << "Signal: cannot add delegate, null provided to add()" << std::endl;
+#endif //DELEGATES_TRACE
+
+#if DELEGATES_STRICT
+      throw std::runtime_error("Signal: cannot add delegate, null provided to add()");
+#endif //DELEGATES_STRICT
+      return;
+    }
+
+    delegate_->add(std::move(delegate), tag, args_mode);
+  }
+
   void get_all(std::vector<IDelegate*>& delegates) const override {
     delegate_->get_all(delegates);
   }
@@ -159,6 +204,7 @@ struct Signal : public virtual ISignal {
   void remove(const std::string& tag) override { delegate_->remove(tag); }
   void remove(IDelegate* delegate) override { delegate_->remove(delegate); }
   void remove(std::shared_ptr<IDelegate> delegate) override { delegate_->remove(delegate); }
+  void remove(const DelegateHandle& delegate) override { delegate_->remove(delegate); }
   void remove_all() override { delegate_->remove_all(); }
 
   IDelegate* get_delegate() const { return delegate_.get(); }
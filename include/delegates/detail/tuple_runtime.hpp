@@ -25,6 +25,8 @@
 
 #include "../delegates_conf.h"
 
+#include <cassert>
+#include <cstddef>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -44,29 +46,70 @@ struct runtime_param_func_table;
 
 template<
   typename Tuple,
-  typename TDefaultValTuple,
   typename Indices = std::make_index_sequence<std::tuple_size<Tuple>::value> >
 struct runtime_param_set_func_table;
 
-// set value in tuple by element index from void* pointer to value. Or default value from another tuple
-// type hash is used for check that element has the same type as user provided
-template<size_t Idx, typename Tuple, typename TDefaultValTuple>
-constexpr bool tuple_set_value_or_default_ptr_fn(Tuple& tup, TDefaultValTuple& tup_def_values, const void* pv, size_t type_hash)  {
+template<
+  typename Tuple,
+  typename Indices = std::make_index_sequence<std::tuple_size<Tuple>::value> >
+struct runtime_param_move_func_table;
+
+// check that tuple element has the same type as user provided. Empty hash or null value are always accepted
+// type_id ignores references and cv-qualifiers, so T, T& and const T& are matched by single compare with constant
+template<size_t Idx, typename Tuple>
+constexpr bool tuple_element_type_matches(const void* pv, size_t type_hash) {
   using elem_orig_type = typename std::tuple_element<Idx,Tuple>::type;
+
+  return !type_hash || !pv || type_id<elem_orig_type>() == type_hash;
+}
+
+// copy value from void* pointer to tuple element
+template<typename T>
+constexpr bool tuple_copy_value(T& v, const void* pv, std::true_type) {
+  v = *reinterpret_cast<const T*>(pv);
+  return true;
+}
+
+// move-only element can't be copied
+template<typename T>
+constexpr bool tuple_copy_value(T& v, const void* pv, std::false_type) {
+  (void)v; (void)pv;
+  return false;
+}
+
+// set value in tuple by element index from void* pointer to value. Or default constructed value when pointer is null
+// type hash is used for check that element has the same type as user provided
+// returns false for move-only element types when pointer is not null (use tuple_move_value_or_default_ptr_fn)
+template<size_t Idx, typename Tuple>
+constexpr bool tuple_set_value_or_default_ptr_fn(Tuple& tup, const void* pv, size_t type_hash)  {
+  using elem_type_noconst = typename std::decay< typename std::tuple_element<Idx,Tuple>::type >::type;
+
+  if (!tuple_element_type_matches<Idx, Tuple>(pv, type_hash))
+    return false;
+
+  elem_type_noconst& v = const_cast<elem_type_noconst&>( std::get<Idx>(tup) );
+  if (pv)
+    return tuple_copy_value(v, pv, std::is_copy_assignable<elem_type_noconst>());
+
+  v = elem_type_noconst();
+  return true;
+};
+
+// move value into tuple by element index from void* pointer to value. Or default constructed value when pointer is null
+// source value is left in moved-from state
+template<size_t Idx, typename Tuple>
+constexpr bool tuple_move_value_or_default_ptr_fn(Tuple& tup, void* pv, size_t type_hash)  {
   using elem_type_noconst = typename std::decay< typename std::tuple_element<Idx,Tuple>::type >::type;
-  using elem_type_noref = typename std::remove_reference< typename std::tuple_element<Idx,Tuple>::type >::type;
 
-  if (type_hash && pv
-      && typeid(elem_orig_type).hash_code() != type_hash
-      && typeid(elem_type_noref).hash_code() != type_hash
-      && typeid(elem_type_noconst).hash_code() != type_hash) {
+  if (!tuple_element_type_matches<Idx, Tuple>(pv, type_hash))
     return false;
-  }
 
-  const elem_type_noconst* p_input = reinterpret_cast<const elem_type_noconst*>(pv);
+  elem_type_noconst* p_input = reinterpret_cast<elem_type_noconst*>(pv);
   elem_type_noconst& v = const_cast<elem_type_noconst&>( std::get<Idx>(tup) );
-  elem_type_noconst& default_v = std::get<Idx>(tup_def_values);
-  v = p_input ? *p_input : default_v;
+  if (p_input)
+    v = std::move(*p_input);
+  else
+    v = elem_type_noconst();
   return true;
 };
 
@@ -75,7 +118,7 @@ template<size_t Idx, typename Tuple>
 constexpr size_t tuple_get_item_type_hash_fn(const Tuple& tup)  {
   (void)tup;
   using elem_type=typename std::tuple_element<Idx,Tuple>::type;
-  return typeid(elem_type).hash_code();
+  return type_id<elem_type>();
 };
 
 // get void* pointer tuple element by index
@@ -86,62 +129,163 @@ constexpr void* tuple_get_item_value_ptr_fn(Tuple& tup)  {
   return (void*)(&v);
 };
 
-template<typename Tuple, typename TDefaultValTuple, size_t ... Indices>
-struct runtime_param_set_func_table<Tuple, TDefaultValTuple, std::index_sequence<Indices...> > {
-  using set_ptr_func_ptr = bool(*)(Tuple&, TDefaultValTuple&, const void*, size_t);
+template<typename Tuple, size_t ... Indices>
+struct runtime_param_set_func_table<Tuple, std::index_sequence<Indices...> > {
+  using set_ptr_func_ptr = bool(*)(Tuple&, const void*, size_t);
   static constexpr set_ptr_func_ptr set_table[std::tuple_size<Tuple>::value] = { &tuple_set_value_or_default_ptr_fn<Indices>... };
 };
 
+template<typename Tuple, size_t ... Indices>
+struct runtime_param_move_func_table<Tuple, std::index_sequence<Indices...> > {
+  using move_ptr_func_ptr = bool(*)(Tuple&, void*, size_t);
+  static constexpr move_ptr_func_ptr move_table[std::tuple_size<Tuple>::value] = { &tuple_move_value_or_default_ptr_fn<Indices>... };
+};
+
 template<typename Tuple, size_t ... Indices>
 struct runtime_param_func_table<Tuple,std::index_sequence<Indices...> >{
   using get_type_func_ptr = size_t(*)(const Tuple&);
   using get_ptr_func_ptr = void*(*)(Tuple&);
 
   static constexpr get_type_func_ptr get_type_table[std::tuple_size<Tuple>::value]={ &tuple_get_item_type_hash_fn<Indices>... };
+  static constexpr size_t type_table[std::tuple_size<Tuple>::value]={ type_id<typename std::tuple_element<Indices,Tuple>::type>()... };
   static constexpr get_ptr_func_ptr get_ptr_table[std::tuple_size<Tuple>::value]={ &tuple_get_item_value_ptr_fn<Indices>... };
 };
 
-template<typename Tuple, typename TDefaultValTuple, size_t ... Indices>
+template<typename Tuple, size_t ... Indices>
 constexpr typename
-  runtime_param_set_func_table<Tuple, TDefaultValTuple, std::index_sequence<Indices...> >::set_ptr_func_ptr
-    runtime_param_set_func_table<Tuple, TDefaultValTuple, std::index_sequence<Indices...> >::set_table[std::tuple_size<Tuple>::value];
+  runtime_param_set_func_table<Tuple, std::index_sequence<Indices...> >::set_ptr_func_ptr
+    runtime_param_set_func_table<Tuple, std::index_sequence<Indices...> >::set_table[std::tuple_size<Tuple>::value];
+
+template<typename Tuple, size_t ... Indices>
+constexpr typename
+  runtime_param_move_func_table<Tuple, std::index_sequence<Indices...> >::move_ptr_func_ptr
+    runtime_param_move_func_table<Tuple, std::index_sequence<Indices...> >::move_table[std::tuple_size<Tuple>::value];
 
 template<typename Tuple,size_t ... Indices>
 constexpr typename
   runtime_param_func_table<Tuple,std::index_sequence<Indices...>>::get_type_func_ptr
     runtime_param_func_table<Tuple,std::index_sequence<Indices...>>::get_type_table[std::tuple_size<Tuple>::value];
 
+template<typename Tuple,size_t ... Indices>
+constexpr size_t runtime_param_func_table<Tuple,std::index_sequence<Indices...>>::type_table[std::tuple_size<Tuple>::value];
+
 template<typename Tuple,size_t ... Indices>
 constexpr typename
   runtime_param_func_table<Tuple,std::index_sequence<Indices...>>::get_ptr_func_ptr
     runtime_param_func_table<Tuple,std::index_sequence<Indices...>>::get_ptr_table[std::tuple_size<Tuple>::value];
 
+// out of range error of checked accessors
+template<typename T>
+DELEGATES_NOINLINE T runtime_tuple_out_of_range() {
+#if DELEGATES_EXCEPTIONS
+  throw std::runtime_error("Out of range");
+#else
+  return T();
+#endif //DELEGATES_EXCEPTIONS
+}
+
 }//namespace detail
 
-template<typename Tuple, typename TDefaultValTuple>
-constexpr bool runtime_tuple_set_value_ptr(Tuple&& tup, TDefaultValTuple&& tdefault, size_t index, const void* pv, size_t type_hash) {
+// Unchecked access: index must be less than tuple size (checked by assert only). Compiles to indexed table load,
+// used when index is already validated by caller
+
+// set tuple element by index from void* pointer to value. Null pointer resets element to default constructed value
+template<typename Tuple>
+constexpr bool runtime_tuple_set_value_ptr_unchecked(Tuple&& tup, size_t index, const void* pv, size_t type_hash) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  assert(index < std::tuple_size<tuple_type>::value);
+  return detail::runtime_param_set_func_table<tuple_type>::set_table[index](tup,pv,type_hash);
+}
+
+// move tuple element by index from void* pointer to value. Null pointer resets element to default constructed value
+template<typename Tuple>
+constexpr bool runtime_tuple_move_value_ptr_unchecked(Tuple&& tup, size_t index, void* pv, size_t type_hash) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  assert(index < std::tuple_size<tuple_type>::value);
+  return detail::runtime_param_move_func_table<tuple_type>::move_table[index](tup,pv,type_hash);
+}
+
+template<typename Tuple>
+constexpr size_t runtime_tuple_get_element_type_hash_unchecked(Tuple&& tup, size_t index) {
+  (void)tup;
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  assert(index < std::tuple_size<tuple_type>::value);
+  return detail::runtime_param_func_table<tuple_type>::type_table[index];
+}
+
+template<typename Tuple>
+constexpr void* runtime_tuple_get_value_ptr_unchecked(Tuple&& tup, size_t index) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  assert(index < std::tuple_size<tuple_type>::value);
+  return detail::runtime_param_func_table<tuple_type>::get_ptr_table[index](tup);
+}
+
+// Checked access without exceptions: out of range index is reported by return value (false, 0 or nullptr)
+
+template<typename Tuple>
+constexpr bool runtime_tuple_try_set_value_ptr(Tuple&& tup, size_t index, const void* pv, size_t type_hash) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  return index < std::tuple_size<tuple_type>::value &&
+    runtime_tuple_set_value_ptr_unchecked(std::forward<Tuple>(tup), index, pv, type_hash);
+}
+
+template<typename Tuple>
+constexpr bool runtime_tuple_try_move_value_ptr(Tuple&& tup, size_t index, void* pv, size_t type_hash) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  return index < std::tuple_size<tuple_type>::value &&
+    runtime_tuple_move_value_ptr_unchecked(std::forward<Tuple>(tup), index, pv, type_hash);
+}
+
+template<typename Tuple>
+constexpr size_t runtime_tuple_try_get_element_type_hash(Tuple&& tup, size_t index) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  return index < std::tuple_size<tuple_type>::value ?
+    runtime_tuple_get_element_type_hash_unchecked(std::forward<Tuple>(tup), index) : 0;
+}
+
+template<typename Tuple>
+constexpr void* runtime_tuple_try_get_value_ptr(Tuple&& tup, size_t index) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+  return index < std::tuple_size<tuple_type>::value ?
+    runtime_tuple_get_value_ptr_unchecked(std::forward<Tuple>(tup), index) : nullptr;
+}
+
+// Checked access: out of range index throws std::runtime_error (or is reported by return value when exceptions are disabled)
+
+// set tuple element by index from void* pointer to value. Null pointer resets element to default constructed value
+template<typename Tuple>
+constexpr bool runtime_tuple_set_value_ptr(Tuple&& tup, size_t index, const void* pv, size_t type_hash) {
+  using tuple_type=typename std::remove_reference<Tuple>::type;
+
+  if (index>=std::tuple_size<tuple_type>::value)
+    return detail::runtime_tuple_out_of_range<bool>();
+  return runtime_tuple_set_value_ptr_unchecked(std::forward<Tuple>(tup), index, pv, type_hash);
+}
+
+// move tuple element by index from void* pointer to value. Null pointer resets element to default constructed value
+template<typename Tuple>
+constexpr bool runtime_tuple_move_value_ptr(Tuple&& tup, size_t index, void* pv, size_t type_hash) {
   using tuple_type=typename std::remove_reference<Tuple>::type;
-  using default_val_tuple_type = typename std::remove_reference<TDefaultValTuple>::type;
 
   if (index>=std::tuple_size<tuple_type>::value)
-    throw std::runtime_error("Out of range");
-  return detail::runtime_param_set_func_table<tuple_type, default_val_tuple_type>::set_table[index](tup,tdefault,pv,type_hash);
+    return detail::runtime_tuple_out_of_range<bool>();
+  return runtime_tuple_move_value_ptr_unchecked(std::forward<Tuple>(tup), index, pv, type_hash);
 }
 
 template<typename Tuple>
 constexpr size_t runtime_tuple_get_element_type_hash(Tuple&& tup,size_t index){
   using tuple_type=typename std::remove_reference<Tuple>::type;
   if (index>=std::tuple_size<tuple_type>::value)
-    throw std::runtime_error("Out of range");
-  return detail::runtime_param_func_table<tuple_type>::get_type_table[index](tup);
+    return detail::runtime_tuple_out_of_range<size_t>();
+  return runtime_tuple_get_element_type_hash_unchecked(std::forward<Tuple>(tup), index);
 }
 
 template<typename Tuple>
 constexpr void* runtime_tuple_get_value_ptr(Tuple&& tup,size_t index){
   using tuple_type=typename std::remove_reference<Tuple>::type;
   if (index>=std::tuple_size<tuple_type>::value)
-    throw std::runtime_error("Out of range");
-  return detail::runtime_param_func_table<tuple_type>::get_ptr_table[index](tup);
+    return detail::runtime_tuple_out_of_range<void*>();
+  return runtime_tuple_get_value_ptr_unchecked(std::forward<Tuple>(tup), index);
 }
 
 
@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2025, Alex Bobryshev <alexbobryshev555@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef DELEGATES_TYPE_ID_HEADER
+#define DELEGATES_TYPE_ID_HEADER
+
+#include "../delegates_conf.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define DELEGATES_TYPE_SIGNATURE __FUNCSIG__
+#else
+#define DELEGATES_TYPE_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
+DELEGATES_BASE_NAMESPACE_BEGIN
+
+namespace delegates {
+namespace detail {
+
+// 64-bit FNV-1a hash of string
+constexpr uint64_t type_id_fnv1a(const char* s, size_t n) {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < n; i++) {
+    hash ^= static_cast<uint64_t>(static_cast<unsigned char>(s[i]));
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// compiler provided signature of this function contains full type name of T, its hash is used as type identifier
+template<typename T>
+constexpr uint64_t type_id_signature_hash() {
+  return type_id_fnv1a(DELEGATES_TYPE_SIGNATURE, sizeof(DELEGATES_TYPE_SIGNATURE) - 1);
+}
+
+// check that string s of length n contains zero-terminated string what
+constexpr bool type_id_contains(const char* s, size_t n, const char* what) {
+  for (size_t i = 0; i < n; i++) {
+    size_t j = 0;
+    while (what[j] && i + j < n && s[i + j] == what[j])
+      j++;
+    if (!what[j])
+      return true;
+  }
+  return false;
+}
+
+// closure types have no unique names: GCC prints all lambdas of single scope with the same signature equally
+template<typename T>
+constexpr bool type_id_is_closure() {
+  return type_id_contains(DELEGATES_TYPE_SIGNATURE, sizeof(DELEGATES_TYPE_SIGNATURE) - 1, "<lambda(") ||
+    type_id_contains(DELEGATES_TYPE_SIGNATURE, sizeof(DELEGATES_TYPE_SIGNATURE) - 1, "(lambda at ") ||
+    type_id_contains(DELEGATES_TYPE_SIGNATURE, sizeof(DELEGATES_TYPE_SIGNATURE) - 1, "<lambda_");
+}
+
+// holder forces compile-time evaluation of type identifier
+template<typename T>
+struct type_id_holder {
+  static constexpr uint64_t value = type_id_signature_hash<T>();
+};
+
+template<typename T>
+constexpr uint64_t type_id_holder<T>::value;
+
+// FNV-1a over type identifiers of parameter pack, pack size is included so empty pack has its own value
+template<size_t N>
+constexpr uint64_t signature_id_combine(const uint64_t (&ids)[N]) {
+  uint64_t hash = 14695981039346656037ull ^ static_cast<uint64_t>(N - 1);
+  for (size_t i = 1; i < N; i++) {
+    hash ^= ids[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// bit mask of flags of parameter pack, first element is placeholder; arguments after 64th are not tracked
+template<size_t N>
+constexpr uint64_t arguments_mask(const bool (&flags)[N]) {
+  uint64_t mask = 0;
+  for (size_t i = 1; i < N && i <= 64; i++) {
+    if (flags[i])
+      mask |= 1ull << (i - 1);
+  }
+  return mask;
+}
+
+template<typename... TArgs>
+struct signature_id_holder {
+  // first element is placeholder, so array is not empty for empty pack
+  static constexpr uint64_t ids[sizeof...(TArgs) + 1] = { 0, type_id_holder<
+    typename std::remove_cv<typename std::remove_reference<TArgs>::type>::type>::value... };
+  static constexpr uint64_t value = signature_id_combine(ids);
+};
+
+template<typename... TArgs>
+constexpr uint64_t signature_id_holder<TArgs...>::ids[sizeof...(TArgs) + 1];
+
+template<typename... TArgs>
+constexpr uint64_t signature_id_holder<TArgs...>::value;
+
+}//namespace detail
+
+/// \brief    Compile-time type identifier, replacement of typeid(T).hash_code() which does not require RTTI
+///           Like typeid, identifiers for T, T&, const T& and const T are the same.
+///           Value is stable for the same compiler, but may differ between compilers
+/// \note     Identifier is made from type name, so types without unique names may get equal identifiers:
+///           closures (lambdas) of the same scope and signature, and types with the same name declared in
+///           anonymous namespaces of different translation units. Closure types are rejected as delegate
+///           argument and result types (see is_unnamed_type), types in anonymous namespaces must have unique names
+/// \return   64-bit type identifier (truncated to size_t on 32-bit platforms)
+template<typename T>
+constexpr size_t type_id() {
+  return static_cast<size_t>(detail::type_id_holder<
+    typename std::remove_cv<typename std::remove_reference<T>::type>::type>::value);
+}
+
+/// \brief    Check that type identifier of T may collide with other types because T has no unique name (closure type).
+///           Such types can't be used as delegate arguments or result
+template<typename T>
+struct is_unnamed_type : std::integral_constant<bool, detail::type_id_is_closure<
+  typename std::remove_cv<typename std::remove_reference<T>::type>::type>()> {};
+
+/// \brief    Compile-time fingerprint of arguments types list. Arguments lists are compatible when fingerprints
+///           are equal: each argument type_id and arguments count are the same
+/// \return   64-bit fingerprint (truncated to size_t on 32-bit platforms)
+template<typename... TArgs>
+constexpr size_t signature_id() {
+  return static_cast<size_t>(detail::signature_id_holder<TArgs...>::value);
+}
+
+}//namespace delegates
+
+DELEGATES_BASE_NAMESPACE_END
+
+#endif //DELEGATES_TYPE_ID_HEADER
@@ -24,19 +24,232 @@
 #define DELEGATES_CPP_DELEGATE_INTERFACE_HEADER
 
 #include "delegates_conf.h"
+#include "detail/type_id.hpp"
+#include "detail/delegate_wait.hpp"
 
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <memory>
 #include <functional>
 #include <stdexcept>
+#include <tuple>
 #include <vector>
 
 DELEGATES_BASE_NAMESPACE_BEGIN
 
 namespace delegates {
 
+/// \brief    Compact deleter for values owned by delegates: plain function pointer plus optional context.
+///           Empty deleter does nothing and requires no allocation. Plain functions and captureless lambdas
+///           are stored as function pointers, other callables are moved to heap and owned by deleter.
+///           Deleter is one-shot: after call it becomes empty. Destroying deleter without call releases
+///           its context but does not touch the value.
+class DelegateDeleter {
+ public:
+  /// \brief    Deleter function. value is null when deleter is released without call
+  using func_type = void(*)(void* value, void* context, void(*context_func)());
+
+  DelegateDeleter() noexcept = default;
+  DelegateDeleter(std::nullptr_t) noexcept {}
+
+  /// \brief    Deleter from function pointer with raw context
+  DelegateDeleter(func_type fn, void* context) noexcept : fn_(fn) { context_.ptr_ = context; }
+
+  /// \brief    Deleter from callable which accepts void* pointer to value
+  template<typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, DelegateDeleter>::value>::type>
+  DelegateDeleter(F&& f) {
+    init(std::forward<F>(f), std::is_convertible<F, void(*)(void*)>{});
+  }
+
+  DelegateDeleter(DelegateDeleter&& other) noexcept : fn_(other.fn_), context_(other.context_) {
+    other.fn_ = nullptr;
+  }
+
+  DelegateDeleter& operator=(DelegateDeleter&& other) noexcept {
+    if (this != &other) {
+      reset();
+      fn_ = other.fn_;
+      context_ = other.context_;
+      other.fn_ = nullptr;
+    }
+    return *this;
+  }
+
+  DelegateDeleter(const DelegateDeleter&) = delete;
+  DelegateDeleter& operator=(const DelegateDeleter&) = delete;
+
+  ~DelegateDeleter() { reset(); }
+
+  /// \brief    Make deleter for value of type T from callable which accepts T&, const T& or T
+  template<typename T, typename F>
+  static DelegateDeleter make(F&& f) {
+    using value_type = typename std::decay<T>::type;
+    return make_typed<value_type>(std::forward<F>(f),
+      std::integral_constant<int,
+        std::is_convertible<F, void(*)(value_type&)>::value ? 1 :
+        std::is_convertible<F, void(*)(const value_type&)>::value ? 2 :
+        std::is_convertible<F, void(*)(value_type)>::value ? 3 : 0>{});
+  }
+
+  /// \brief    true if deleter is not empty
+  explicit operator bool() const noexcept { return fn_ != nullptr; }
+
+  /// \brief    Call deleter for value. Deleter becomes empty after call
+  void operator()(void* value) {
+    func_type fn = fn_;
+    fn_ = nullptr;
+    if (fn)
+      fn(value, context_.ptr_, context_.fn_);
+  }
+
+  /// \brief    Release deleter context without call for value
+  void reset() noexcept {
+    func_type fn = fn_;
+    fn_ = nullptr;
+    if (fn)
+      fn(nullptr, context_.ptr_, context_.fn_);
+  }
+
+ private:
+  template<typename F>
+  void init(F&& f, std::true_type) {
+    using plain_func_type = void(*)(void*);
+    plain_func_type pf = f;
+    if (!pf)
+      return;
+    context_.fn_ = reinterpret_cast<void(*)()>(pf);
+    fn_ = [](void* value, void*, void(*context_func)()) {
+      if (value) reinterpret_cast<plain_func_type>(context_func)(value);
+    };
+  }
+
+  template<typename F>
+  void init(F&& f, std::false_type) {
+    using callable_type = typename std::decay<F>::type;
+    if (callable_empty(f, 0))
+      return;
+    context_.ptr_ = new callable_type(std::forward<F>(f));
+    fn_ = [](void* value, void* context, void(*)()) {
+      callable_type* callable = static_cast<callable_type*>(context);
+      if (value) (*callable)(value);
+      delete callable;
+    };
+  }
+
+  // empty std::function and other callables testable by bool give empty deleter
+  template<typename F>
+  static auto callable_empty(const F& f, int) -> decltype(static_cast<bool>(f)) { return !static_cast<bool>(f); }
+
+  template<typename F>
+  static bool callable_empty(const F&, long) { return false; }
+
+  template<typename T, typename TFunc>
+  static DelegateDeleter make_typed_func(TFunc pf) {
+    DelegateDeleter d;
+    if (!pf)
+      return d;
+    d.context_.fn_ = reinterpret_cast<void(*)()>(pf);
+    d.fn_ = [](void* value, void*, void(*context_func)()) {
+      if (value) reinterpret_cast<TFunc>(context_func)(*static_cast<T*>(value));
+    };
+    return d;
+  }
+
+  template<typename T, typename F>
+  static DelegateDeleter make_typed(F&& f, std::integral_constant<int, 1>) { return make_typed_func<T, void(*)(T&)>(f); }
+
+  template<typename T, typename F>
+  static DelegateDeleter make_typed(F&& f, std::integral_constant<int, 2>) { return make_typed_func<T, void(*)(const T&)>(f); }
+
+  template<typename T, typename F>
+  static DelegateDeleter make_typed(F&& f, std::integral_constant<int, 3>) { return make_typed_func<T, void(*)(T)>(f); }
+
+  template<typename T, typename F>
+  static DelegateDeleter make_typed(F&& f, std::integral_constant<int, 0>) {
+    using callable_type = typename std::decay<F>::type;
+    if (callable_empty(f, 0))
+      return DelegateDeleter();
+    return DelegateDeleter([](void* value, void* context, void(*)()) {
+      callable_type* callable = static_cast<callable_type*>(context);
+      if (value) (*callable)(*static_cast<T*>(value));
+      delete callable;
+    }, new callable_type(std::forward<F>(f)));
+  }
+
+  union Context {
+    void* ptr_;
+    void (*fn_)();
+  };
+
+  func_type fn_ = nullptr;
+  Context context_ = {};
+};
+
+/// \brief    Completion flag of asynchronous call, kept in delegate result storage, so no separate shared state is
+///           allocated per call. Waiting thread spins briefly, then is parked (std::atomic::wait in C++20,
+///           futex on Linux, WaitOnAddress on Windows, condition variables elsewhere, see delegate_wait.hpp)
+class DelegateCompletion {
+ public:
+  DelegateCompletion() noexcept = default;
+
+  /// \brief    Mark call as started. Called before call is posted to executor
+  void start() noexcept { state_.store(kPending, std::memory_order_relaxed); }
+
+  /// \brief    Mark call as completed and wake up waiters. Result must be stored before this call
+  /// \param    ok - call status
+  void complete(bool ok) noexcept {
+    // waiters are woken up only if some thread is parked, so completion without waiters takes no syscall
+    if (state_.exchange(ok ? kSucceeded : kFailed, std::memory_order_acq_rel) == kPendingWaited)
+      detail::atomic_notify_all(state_);
+  }
+
+  /// \brief    Check if started call is completed (or call was not started at all)
+  bool ready() const noexcept { return !pending(state_.load(std::memory_order_acquire)); }
+
+  /// \brief    Wait until started call is completed. Waiter spins briefly, then is parked by OS
+  ///           (futex on Linux, WaitOnAddress on Windows, std::atomic::wait in C++20)
+  /// \return   call status: true if call was successful
+  bool wait() const noexcept {
+    uint32_t state = state_.load(std::memory_order_acquire);
+    for (int spin = 0; spin < kSpinCount && pending(state); spin++)
+      state = state_.load(std::memory_order_acquire);
+
+    while (pending(state)) {
+      // mark that waiter is going to park, so complete() knows it must wake it up
+      if (state == kPending &&
+        !state_.compare_exchange_weak(state, kPendingWaited, std::memory_order_acquire, std::memory_order_acquire))
+        continue;
+      detail::atomic_wait_value(state_, kPendingWaited);
+      state = state_.load(std::memory_order_acquire);
+    }
+    return state == kSucceeded;
+  }
+
+ private:
+  DelegateCompletion(const DelegateCompletion&) = delete;
+  DelegateCompletion& operator=(const DelegateCompletion&) = delete;
+
+  enum : uint32_t {
+    kIdle = 0,
+    kPending = 1,
+    kSucceeded = 2,
+    kFailed = 3,
+    kPendingWaited = 4  // pending and some thread is parked in wait()
+  };
+
+  static constexpr int kSpinCount = 100;
+
+  static bool pending(uint32_t state) noexcept { return state == kPending || state == kPendingWaited; }
+
+  mutable std::atomic<uint32_t> state_{ kIdle };
+};
+
 /// \brief    Result of call accessor interface
 ///           Provides type-safe and low-level access to delegate call results.
 ///           Used by executors to retrieve results without knowing the exact type at compile time.
@@ -58,14 +271,33 @@ struct IDelegateResult {
   /// \brief    get size of result varialbe in bytes
   virtual int size_bytes() const = 0;
 
-  /// \brief    get RTTI hash code of result type
+  /// \brief    get type hash code of result type (see type_id<T>())
   virtual size_t hash_code() const = 0;
 
   /// \brief    set result value by void* pointer
-  virtual bool set_ptr(const void* value_ptr, size_t type_hash, std::function<void(void*)> deleter_ptr = [](void*) {}) = 0;
+  virtual bool set_ptr(const void* value_ptr, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) = 0;
 
-  /// \brief    detach stored value (copy to new buffer without call of deleter)
-  virtual bool detach_ptr(void* value_ptr, size_t value_buffer_size, std::function<void(void*)>& deleter_ptr) = 0;
+  /// \brief    set result value by moving it from void* pointer. Source value is left in moved-from state
+  virtual bool set_move_ptr(void* value_ptr, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) = 0;
+
+  /// \brief    detach stored value (move to caller buffer without call of deleter, deleter is passed to caller)
+  virtual bool detach_ptr(void* value_ptr, size_t value_buffer_size, DelegateDeleter& deleter) = 0;
+
+  /// \brief    move stored value and its deleter to another result of the same type. This result becomes empty
+  /// \param    to - destination result
+  /// \return   true - OK, false - no value or result types are different
+  virtual bool move_to(IDelegateResult* to) = 0;
+
+  /// \brief    destroy stored value without deleter call (ownership of value was taken by caller)
+  virtual void release() = 0;
+
+  /// \brief    check is result value can be copied. Move-only results (e.g. std::unique_ptr) can't be
+  ///           copied by set_ptr()/get<T>(), use set_move_ptr(), move_to() or take<T>() for them
+  virtual bool copyable() const = 0;
+
+  /// \brief    get completion flag of asynchronous call (see IDelegate::call_async())
+  /// \return   completion flag or nullptr if result does not support asynchronous calls
+  virtual DelegateCompletion* completion() { return nullptr; }
 
   /// \brief   get copy of result value
   /// \return  copy of argument value
@@ -73,8 +305,8 @@ struct IDelegateResult {
   TValue get() const {
     using value_noref = typename std::decay<TValue>::type;
 
-    if (typeid(TValue).hash_code() != hash_code())
-      throw std::runtime_error("Value type error");
+    if (type_id<TValue>() != hash_code())
+      DELEGATES_THROW(std::runtime_error("Value type error"));
 
     return *(reinterpret_cast<const value_noref*>(get_ptr()));
   }
@@ -86,13 +318,31 @@ struct IDelegateResult {
   bool try_get(TValue& out_value) const {
     using value_noref = typename std::decay<TValue>::type;
 
-    if (typeid(TValue).hash_code() != hash_code())
+    if (type_id<TValue>() != hash_code())
       return false;
 
     out_value = *(reinterpret_cast<const value_noref*>(get_ptr()));
     return true;
   }
 
+  /// \brief   move result value out, result becomes empty. Works for move-only result types
+  /// \note    deleter is not called for taken value, caller owns it
+  /// \return  result value, always by value: reference to taken value would dangle
+  template<typename TValue>
+  typename std::decay<TValue>::type take() {
+    using value_noref = typename std::decay<TValue>::type;
+
+    if (type_id<TValue>() != hash_code())
+      DELEGATES_THROW(std::runtime_error("Value type error"));
+
+    if (!has_value())
+      DELEGATES_THROW(std::runtime_error("Value is not set"));
+
+    value_noref value(std::move(*(reinterpret_cast<value_noref*>(get_ptr()))));
+    release();
+    return value;
+  }
+
   template<typename TResult>
   const TResult& get_or_default(const TResult& def = TResult()) const {
     auto ptr = get_ptr();
@@ -101,19 +351,107 @@ struct IDelegateResult {
 
   /// \brief    Store result value copy by const ref
   /// \param    value - reference to result value
-  /// \param    deleter - deleter function which called when result value is released by delegate
   template<typename TValue>
-  bool set(const TValue& value, std::function<void(TValue&)> deleter = [](TValue&) {}) {
-    using value_noref = typename std::decay<TValue>::type;
+  bool set(const TValue& value) {
+    return set_ptr(reinterpret_cast<const void*>(&value), type_id<TValue>());
+  }
 
-    std::function<void(void*)> deleter_ptr = [deleter](void* ptr) {
-      value_noref* pv = reinterpret_cast<value_noref*>(ptr);
-      if (pv) deleter(*pv);
-    };
-    return set_ptr(reinterpret_cast<const void*>(&value), typeid(TValue).hash_code(), deleter_ptr);
+  /// \brief    Store result value copy by const ref
+  /// \param    value - reference to result value
+  /// \param    deleter - callable with TValue&, const TValue& or TValue argument, called when result value is released
+  template<typename TValue, typename TDeleter>
+  bool set(const TValue& value, TDeleter&& deleter) {
+    return set_ptr(reinterpret_cast<const void*>(&value), type_id<TValue>(),
+      DelegateDeleter::make<TValue>(std::forward<TDeleter>(deleter)));
+  }
+
+  /// \brief    Store result value by moving it from rvalue
+  /// \param    value - rvalue reference to result value
+  template<typename TValue, typename = typename std::enable_if<!std::is_lvalue_reference<TValue>::value && !std::is_const<TValue>::value>::type>
+  bool set(TValue&& value) {
+    return set_move_ptr(reinterpret_cast<void*>(&value), type_id<TValue>());
+  }
+
+  /// \brief    Store result value by moving it from rvalue
+  /// \param    value - rvalue reference to result value
+  /// \param    deleter - callable with TValue&, const TValue& or TValue argument, called when result value is released
+  template<typename TValue, typename TDeleter, typename = typename std::enable_if<!std::is_lvalue_reference<TValue>::value && !std::is_const<TValue>::value>::type>
+  bool set(TValue&& value, TDeleter&& deleter) {
+    return set_move_ptr(reinterpret_cast<void*>(&value), type_id<TValue>(),
+      DelegateDeleter::make<TValue>(std::forward<TDeleter>(deleter)));
   }
 };
 
+/// \brief    Handle of asynchronous call started by IDelegate::call_async(). It is not owning: shared state is
+///           completion flag in delegate result, so delegate must outlive the call and only one asynchronous call
+///           of the same delegate may be in progress
+class DelegateFuture {
+ public:
+  DelegateFuture() noexcept = default;
+  explicit DelegateFuture(IDelegateResult* result) noexcept : result_(result) {}
+
+  /// \brief    Check if handle refers to started call
+  bool valid() const noexcept { return result_ != nullptr; }
+
+  /// \brief    Check if call is completed, does not block
+  bool ready() const noexcept { return !result_ || result_->completion()->ready(); }
+
+  /// \brief    Wait for call completion
+  /// \return   true if call was successful, false if call failed or handle is not valid
+  bool wait() const noexcept { return result_ && result_->completion()->wait(); }
+
+  /// \brief    Wait for call completion and get result accessor
+  /// \return   delegate result or nullptr if call failed
+  IDelegateResult* result() const noexcept { return wait() ? result_ : nullptr; }
+
+  /// \brief    Wait for call completion and move result value out
+  template<typename TValue>
+  TValue get() {
+    if (!wait())
+      DELEGATES_THROW(std::runtime_error("Asynchronous delegate call failed"));
+    return result_->take<TValue>();
+  }
+
+ protected:
+  IDelegateResult* result_ = nullptr;
+};
+
+/// \brief    Typed view of delegate arguments, created by IDelegateArgs::view<Ts...>().
+///           Holds direct pointers to stored argument values, so access is plain load
+template<typename... Ts>
+class DelegateArgsView {
+ public:
+  template<size_t I>
+  using value_type = typename std::decay<typename std::tuple_element<I, std::tuple<Ts...> >::type>::type;
+
+  /// \brief    Check if arguments types are the same as Ts... and all arguments have values
+  bool valid() const noexcept { return valid_; }
+  explicit operator bool() const noexcept { return valid_; }
+
+  /// \brief    Get reference to argument value. View must be valid
+  template<size_t I>
+  value_type<I>& get() const noexcept {
+    assert(valid_);
+    return *static_cast<value_type<I>*>(ptrs_[I]);
+  }
+
+  /// \brief    Get tuple of references to all arguments values, e.g. for std::tie(). View must be valid
+  std::tuple<typename std::decay<Ts>::type&...> tuple() const noexcept {
+    return tuple(std::index_sequence_for<Ts...>{});
+  }
+
+ private:
+  friend struct IDelegateArgs;
+
+  template<size_t... Is>
+  std::tuple<typename std::decay<Ts>::type&...> tuple(std::index_sequence<Is...>) const noexcept {
+    return std::tuple<typename std::decay<Ts>::type&...>(get<Is>()...);
+  }
+
+  void* ptrs_[sizeof...(Ts) + 1] = {};  // extra element, so array is not empty for empty pack
+  bool valid_ = false;
+};
+
 /// \brief    Delegate arguments accessor interface
 ///           Provides type-safe and low-level access to delegate arguments.
 ///           Supports index-based access for runtime automation and type-based access for convenience.
@@ -128,21 +466,49 @@ struct IDelegateArgs {
   /// \brief    Store argument from void* pointer
   /// \param    idx - argument index
   /// \param    pv - pointer to argument value buffer
-  /// \param    type_hash - RTTI hash code from argument type
-  /// \param    deleter_ptr - deleter function which called when argument value is released by delegate
+  /// \param    type_hash - type hash code from argument type (see type_id<T>())
+  /// \param    deleter - deleter which called when argument value is released by delegate
   /// \return   true - OK, false - type error
-  virtual bool set_ptr(size_t idx, void* pv, size_t type_hash, std::function<void(void*)> deleter_ptr = [](void*) {}) = 0;
+  virtual bool set_ptr(size_t idx, void* pv, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) = 0;
+
+  /// \brief    Store argument by moving it from void* pointer. Source value is left in moved-from state
+  /// \param    idx - argument index
+  /// \param    pv - pointer to argument value buffer
+  /// \param    type_hash - type hash code from argument type (see type_id<T>())
+  /// \param    deleter - deleter which called when argument value is released by delegate
+  /// \return   true - OK, false - type error
+  virtual bool set_move_ptr(size_t idx, void* pv, size_t type_hash, DelegateDeleter deleter = DelegateDeleter()) = 0;
 
   /// \brief    Get void* pointer to stored agrument value by index
   /// \param    idx - argument index
   /// \return   Raw pointer to argument value
   virtual void* get_ptr(size_t idx) const = 0;
 
-  /// \brief    Get argument RTTI type hash code by argument index
+  /// \brief    Get argument type hash code by argument index
   /// \param    idx - argument index
-  /// \return   RTTI type hash code
+  /// \return   type hash code, equals to type_id<T>()
   virtual size_t hash_code(size_t idx) const = 0;
 
+  /// \brief    Get fingerprint of all arguments types
+  /// \return   fingerprint, equals to signature_id<TArgs...>(). Arguments lists with equal fingerprints are compatible
+  virtual size_t signature() const = 0;
+
+  /// \brief    Get pointers to all stored argument values at once
+  /// \param    ptrs - output array of count pointers
+  /// \param    count - arguments count, must be equal to size()
+  /// \return   true - OK, false - count mismatch or some argument has no value
+  virtual bool get_ptrs(void** ptrs, size_t count) const {
+    if (count != size())
+      return false;
+
+    for (size_t i = 0; i < count; i++) {
+      ptrs[i] = get_ptr(i);
+      if (!ptrs[i])
+        return false;
+    }
+    return true;
+  }
+
   /// \brief    Clear argument by index
   /// \param    idx - argument index
   virtual void clear(size_t idx) = 0;
@@ -156,25 +522,46 @@ struct IDelegateArgs {
   template<typename T>
   T get(size_t idx) {
     using value_type = typename std::decay<T>::type;
-    static value_type default_val;
 
-    if (typeid(T).hash_code() != hash_code(idx))
-      throw std::runtime_error("Wrong type provided");
+    if (type_id<T>() != hash_code(idx))
+      DELEGATES_THROW(std::runtime_error("Wrong type provided"));
 
     void* p = get_ptr(idx);
-    return p ? *reinterpret_cast<value_type*>(p) : default_val;
+    if (!p)
+      DELEGATES_THROW(std::runtime_error("Argument is not set"));
+
+    return *reinterpret_cast<value_type*>(p);
   }
 
+  /// \brief   get reference to argument value by argument index
+  /// \param   idx - argument index
+  /// \return  reference to stored argument value
   template<typename T>
   T& get_ref(size_t idx) {
     using value_type = typename std::decay<T>::type;
-    static value_type default_val;
 
-    if (typeid(T).hash_code() != hash_code(idx))
-      throw std::runtime_error("Wrong type provided");
+    if (type_id<T>() != hash_code(idx))
+      DELEGATES_THROW(std::runtime_error("Wrong type provided"));
 
     void* p = get_ptr(idx);
-    return p ? *reinterpret_cast<value_type*>(p) : default_val;
+    if (!p)
+      DELEGATES_THROW(std::runtime_error("Argument is not set"));
+
+    return *reinterpret_cast<value_type*>(p);
+  }
+
+  /// \brief   get typed view of all arguments. Types are validated once, then view gives direct references
+  ///          to stored values without virtual calls or type checks
+  /// \return  view, it is not valid if Ts... are not the same as arguments types
+  /// \note    view refers to arguments storage, it must not outlive arguments
+  template<typename... Ts>
+  DelegateArgsView<Ts...> view() {
+    DelegateArgsView<Ts...> v;
+    if (signature() != signature_id<Ts...>())
+      return v;
+
+    v.valid_ = get_ptrs(v.ptrs_, sizeof...(Ts));
+    return v;
   }
 
   /// \brief   get copy of argument value by argument index
@@ -183,7 +570,7 @@ struct IDelegateArgs {
   /// \return  true - OK, false - wrong type provided
   template<typename T>
   bool try_get(size_t idx, T& out_value) {
-    if (typeid(T).hash_code() != hash_code(idx))
+    if (type_id<T>() != hash_code(idx))
       return false;
 
     void* p = get_ptr(idx);
@@ -194,29 +581,141 @@ struct IDelegateArgs {
     return true;
   }
 
-  /// \brief    Store argument value copy
+  /// \brief    Store argument value copy by const ref
   /// \param    idx - argument index
   /// \param    v - reference to argument value
-  /// \param    deleter - deleter function which called when argument value is released by delegate
   template<typename T>
-  bool set(size_t idx, T& v, std::function<void(T&)> deleter = [](T&) {}) {
-    using value_type = typename std::decay<T>::type;
-    std::function<void(void*)> deleter_ptr = [deleter](void* ptr) { value_type* pv = reinterpret_cast<value_type*>(ptr); if (pv && deleter) deleter(*pv); };
-    return set_ptr(idx, (void*)(&v), typeid(T).hash_code(), deleter_ptr);
+  bool set(size_t idx, const T& v) {
+    return set_ptr(idx, (void*)(&v), type_id<T>());
   }
 
   /// \brief    Store argument value copy by const ref
   /// \param    idx - argument index
   /// \param    v - reference to argument value
-  /// \param    deleter - deleter function which called when argument value is released by delegate
-  template<typename T>
-  bool set(size_t idx, const T& v, std::function<void(T&)> deleter = [](const T&) {}) {
+  /// \param    deleter - callable with T&, const T& or T argument, called when argument value is released by delegate.
+  ///                      Plain functions and captureless lambdas are stored without allocation
+  template<typename T, typename TDeleter>
+  bool set(size_t idx, const T& v, TDeleter&& deleter) {
+    return set_ptr(idx, (void*)(&v), type_id<T>(), DelegateDeleter::make<T>(std::forward<TDeleter>(deleter)));
+  }
+
+  /// \brief    Store argument value by moving it from rvalue
+  /// \param    idx - argument index
+  /// \param    v - rvalue reference to argument value
+  template<typename T, typename = typename std::enable_if<!std::is_lvalue_reference<T>::value && !std::is_const<T>::value>::type>
+  bool set(size_t idx, T&& v) {
+    return set_move_ptr(idx, (void*)(&v), type_id<T>());
+  }
+
+  /// \brief    Store argument value by moving it from rvalue
+  /// \param    idx - argument index
+  /// \param    v - rvalue reference to argument value
+  /// \param    deleter - callable with T&, const T& or T argument, called when argument value is released by delegate
+  template<typename T, typename TDeleter, typename = typename std::enable_if<!std::is_lvalue_reference<T>::value && !std::is_const<T>::value>::type>
+  bool set(size_t idx, T&& v, TDeleter&& deleter) {
+    return set_move_ptr(idx, (void*)(&v), type_id<T>(), DelegateDeleter::make<T>(std::forward<TDeleter>(deleter)));
+  }
+
+  /// \brief    Construct argument value from constructor arguments and move it into delegate
+  /// \param    idx - argument index
+  /// \param    ctor_args - arguments for T constructor
+  template<typename T, typename... TCtorArgs>
+  bool emplace(size_t idx, TCtorArgs&&... ctor_args) {
     using value_type = typename std::decay<T>::type;
-    std::function<void(void*)> deleter_ptr = [deleter](void* ptr) { value_type* pv = reinterpret_cast<value_type*>(ptr); if (pv && deleter) deleter(*pv); };
-    return set_ptr(idx, (void*)(&v), typeid(T).hash_code(), deleter_ptr);
+    value_type v(std::forward<TCtorArgs>(ctor_args)...);
+    return set_move_ptr(idx, (void*)(&v), type_id<T>());
+  }
+};
+
+/// \brief    Caller owned storage of arguments and result for reentrant delegate call.
+///           Implemented by DelegateCallFrame<TResult, TArgs...>
+struct IDelegateCallFrame {
+  virtual ~IDelegateCallFrame() = default;
+
+  /// \brief    Get type_id() of concrete frame type
+  virtual size_t frame_type() const = 0;
+
+  /// \brief    Get frame arguments accessor
+  virtual IDelegateArgs* args() = 0;
+
+  /// \brief    Get frame result accessor
+  virtual IDelegateResult* result() = 0;
+};
+
+/// \brief    Typed direct call interface. Arguments are forwarded to delegate target,
+///           stored arguments and result are not used. Delegates of TResult(TArgs...) signature implement it,
+///           it is queried from IDelegate by IDelegate::invoker<TResult, TArgs...>()
+template<typename TResult, typename... TArgs>
+struct IDelegateInvoke {
+  virtual ~IDelegateInvoke() = default;
+
+  /// \brief    Call delegate target directly
+  /// \return   target result
+  /// \note     Errors can't be reported by return value, so they are reported by exception (std::abort() without exceptions)
+  virtual TResult invoke(TArgs... args) = 0;
+};
+
+/// \brief    Intrusive reference counter embedded in delegates, used by DelegateHandle.
+///           Counter is atomic by default. Single-threaded counter uses plain loads and stores, it may be
+///           used when all handles of the delegate are copied and destroyed by one thread (e.g. single-threaded signals)
+class DelegateRefCount {
+ public:
+  enum Mode {
+    kAtomic = 0,
+    kSingleThread = 1
+  };
+
+  DelegateRefCount() noexcept = default;
+
+  /// \brief    Take first reference to delegate or add reference when delegate is already owned by handles
+  /// \param    mode - counting mode, applied to first reference only
+  void acquire(Mode mode) noexcept {
+    // only one of handles adopting fresh delegate concurrently takes first reference, others add references.
+    // Mode flag is written only for single-threaded mode, which can't be adopted concurrently by definition
+    uint32_t expected = 0;
+    if (count_.compare_exchange_strong(expected, 1, std::memory_order_relaxed)) {
+      if (mode == kSingleThread)
+        single_thread_ = true;
+    } else {
+      add_ref();
+    }
+  }
+
+  void add_ref() noexcept {
+    if (single_thread_)
+      count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    else
+      count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// \brief    Release reference
+  /// \return   true if it was the last reference
+  bool release() noexcept {
+    if (single_thread_) {
+      uint32_t count = count_.load(std::memory_order_relaxed) - 1;
+      count_.store(count, std::memory_order_relaxed);
+      return count == 0;
+    }
+    return count_.fetch_sub(1, std::memory_order_acq_rel) == 1;
   }
+
+  /// \brief    Get current references count
+  uint32_t count() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+ private:
+  DelegateRefCount(const DelegateRefCount&) = delete;
+  DelegateRefCount& operator=(const DelegateRefCount&) = delete;
+
+  std::atomic<uint32_t> count_{ 0 };
+  bool single_thread_ = false;
 };
 
+/// \brief    Bit mask of batch call columns with const elements, see IDelegate::call_batch_ptr()
+template<typename... TArgs>
+constexpr size_t batch_const_columns() {
+  return static_cast<size_t>(detail::arguments_mask<sizeof...(TArgs) + 1>({ false, std::is_const<TArgs>::value... }));
+}
+
 /// \brief    Universal delegate interface for cross-thread and IPC/RPC execution
 ///           This interface allows executors to call delegates without knowing argument or result types.
 ///           The executor can work with IDelegate* pointers in a type-agnostic way, while the enqueuer
@@ -237,6 +736,14 @@ struct IDelegate {
   /// \return   true if call successful, false otherwise
   virtual bool call(IDelegateArgs* args) = 0;
 
+  /// \brief    Reentrant call: arguments are taken from caller owned frame and result is stored to it, delegate
+  ///           arguments and result are not used. Single delegate may be called from many threads at once, each with own frame,
+  ///           when call target is safe to call concurrently: stateful callables (mutable lambdas, std::function
+  ///           with stateful target, method of object changed by call) must synchronize their state themselves
+  /// \param    frame - DelegateCallFrame<TResult, TArgs...> with exactly the same types as delegate
+  /// \return   true if call successful, false otherwise (e.g. frame types mismatch)
+  virtual bool call(IDelegateCallFrame& frame) = 0;
+
   /// \brief    Get delegate arguments accessor
   /// \return   Pointer to arguments interface for setting/getting argument values
   /// \note     Arguments can be set by index using type-safe set<T>() or low-level set_ptr()
@@ -246,6 +753,158 @@ struct IDelegate {
   /// \return   Pointer to result interface for getting call result
   /// \note     Result can be retrieved using type-safe get<T>() or low-level get_ptr()
   virtual IDelegateResult* result() = 0;
+
+  /// \brief    Clear stored arguments and result, delegate target is kept
+  /// \note     Allocated delegate may be reused for next call without reallocation: reset(), set new arguments, call()
+  virtual void reset() = 0;
+
+  /// \brief    Post call with stored arguments to executor and return handle to wait for its completion.
+  ///           No shared state is allocated: completion flag is kept in delegate result
+  /// \param    executor - callable which accepts task (callable without arguments), e.g. thread pool enqueue function
+  /// \return   call handle, it is not valid if delegate result does not support asynchronous calls
+  /// \note     Delegate must outlive the call, only one asynchronous call of the delegate may be in progress
+  template<typename TExecutor>
+  DelegateFuture call_async(TExecutor&& executor) {
+    IDelegateResult* res = result();
+    DelegateCompletion* completion = res ? res->completion() : nullptr;
+    if (!completion)
+      return DelegateFuture();
+
+    completion->start();
+    IDelegate* self = this;
+    executor([self, completion]() {
+#if DELEGATES_EXCEPTIONS
+      bool ok = false;
+      try {
+        ok = self->call();
+      } catch (...) {
+        completion->complete(false);
+        throw;
+      }
+      completion->complete(ok);
+#else
+      completion->complete(self->call());
+#endif //DELEGATES_EXCEPTIONS
+    });
+    return DelegateFuture(res);
+  }
+
+  /// \brief    Batch call over columnar (structure of arrays) arguments: for each row i target is called with
+  ///           (columns[0][i], columns[1][i], ...). Types are checked once, then target is called in a loop
+  /// \param    columns - pointers to arrays of argument values, one array of count elements per argument
+  /// \param    signature - signature_id() of columns element types
+  /// \param    const_columns - bit mask of columns with const elements, bit i is set when column i is const.
+  ///           Const columns are rejected for arguments modified or moved out by target
+  /// \param    count - rows count
+  /// \param    results - array of count results, or nullptr if results are not needed
+  /// \param    result_type - type_id() of results element type
+  /// \return   true if all rows are processed, false on types mismatch or call error
+  /// \note     Stored arguments and result are not changed. Reference arguments refer to columns elements,
+  ///           move-only arguments are moved out of columns.
+  ///           Exception is signal slot which uses its own arguments: it is called with stored arguments once
+  ///           per row and its stored result is updated like for call()
+  virtual bool call_batch_ptr(void* const* columns, size_t signature, size_t const_columns, size_t count,
+    void* results, size_t result_type) = 0;
+
+  /// \brief    Typed batch call: call_batch(count, results, column0, column1, ...)
+  template<typename TResult, typename... TArgs>
+  bool call_batch(size_t count, TResult* results, TArgs*... columns) {
+    void* ptrs[] = { const_cast<void*>(static_cast<const void*>(columns))..., nullptr };
+    return call_batch_ptr(ptrs, signature_id<TArgs...>(), batch_const_columns<TArgs...>(), count,
+      const_cast<void*>(static_cast<const void*>(results)), type_id<TResult>());
+  }
+
+  /// \brief    Typed batch call when results are not needed: call_batch(count, nullptr, column0, column1, ...)
+  template<typename... TArgs>
+  bool call_batch(size_t count, std::nullptr_t, TArgs*... columns) {
+    void* ptrs[] = { const_cast<void*>(static_cast<const void*>(columns))..., nullptr };
+    return call_batch_ptr(ptrs, signature_id<TArgs...>(), batch_const_columns<TArgs...>(), count, nullptr,
+      type_id<void>());
+  }
+
+  /// \brief    Get intrusive reference counter used by DelegateHandle
+  /// \return   counter or nullptr if delegate can't be owned by DelegateHandle
+  virtual DelegateRefCount* ref_count() { return nullptr; }
+
+  /// \brief    Get typed direct call interface
+  /// \param    invoke_type - type_id() of IDelegateInvoke<TResult, TArgs...>
+  /// \return   pointer to IDelegateInvoke<TResult, TArgs...> or nullptr if delegate has other signature or
+  ///           does not support direct call (signals)
+  virtual void* query_invoke(size_t invoke_type) = 0;
+
+  /// \brief    Get typed direct call interface, signature must match exactly (including references and const)
+  /// \return   direct call interface or nullptr
+  template<typename TResult, typename... TArgs>
+  IDelegateInvoke<TResult, TArgs...>* invoker() {
+    return static_cast<IDelegateInvoke<TResult, TArgs...>*>(query_invoke(type_id<IDelegateInvoke<TResult, TArgs...> >()));
+  }
+};
+
+/// \brief    Intrusive reference counted owner of delegate, alternative to std::shared_ptr<IDelegate>.
+///           Handle is one pointer wide, counter is embedded in delegate, so no control block is allocated.
+///           Delegate must be created by new (e.g. factory::make()), it is deleted with the last handle
+class DelegateHandle {
+ public:
+  DelegateHandle() noexcept = default;
+
+  /// \brief    Take ownership of delegate, or share it with other handles if delegate is already owned by handles
+  /// \param    delegate - delegate created by new, must support intrusive counting (delegates and signals from factory)
+  /// \param    mode - counting mode: atomic, or single-threaded when all handles are used by one thread
+  explicit DelegateHandle(IDelegate* delegate, DelegateRefCount::Mode mode = DelegateRefCount::kAtomic)
+    : delegate_(delegate) {
+    if (!delegate_)
+      return;
+
+    DelegateRefCount* counter = delegate_->ref_count();
+    if (!counter)
+      DELEGATES_THROW(std::invalid_argument("DelegateHandle: delegate does not support intrusive reference counting"));
+    counter->acquire(mode);
+  }
+
+  DelegateHandle(const DelegateHandle& other) noexcept : delegate_(other.delegate_) {
+    if (delegate_)
+      delegate_->ref_count()->add_ref();
+  }
+
+  DelegateHandle(DelegateHandle&& other) noexcept : delegate_(other.delegate_) {
+    other.delegate_ = nullptr;
+  }
+
+  DelegateHandle& operator=(const DelegateHandle& other) noexcept {
+    DelegateHandle(other).swap(*this);
+    return *this;
+  }
+
+  DelegateHandle& operator=(DelegateHandle&& other) noexcept {
+    DelegateHandle(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  ~DelegateHandle() { reset(); }
+
+  /// \brief    Release reference, delegate is deleted when it was the last one
+  void reset() noexcept {
+    IDelegate* delegate = delegate_;
+    delegate_ = nullptr;
+    if (delegate && delegate->ref_count()->release())
+      delete delegate;
+  }
+
+  void swap(DelegateHandle& other) noexcept { std::swap(delegate_, other.delegate_); }
+
+  IDelegate* get() const noexcept { return delegate_; }
+  IDelegate* operator->() const noexcept { return delegate_; }
+  IDelegate& operator*() const noexcept { return *delegate_; }
+  explicit operator bool() const noexcept { return delegate_ != nullptr; }
+
+  /// \brief    Get count of handles owning delegate
+  uint32_t use_count() const noexcept { return delegate_ ? delegate_->ref_count()->count() : 0; }
+
+  bool operator==(const DelegateHandle& other) const noexcept { return delegate_ == other.delegate_; }
+  bool operator!=(const DelegateHandle& other) const noexcept { return delegate_ != other.delegate_; }
+
+ private:
+  IDelegate* delegate_ = nullptr;
 };
 
 /// \brief    Multi-delegate aggregator interface
@@ -288,6 +947,14 @@ struct ISignal
     const std::string& tag = std::string(),
     DelegateArgsMode args_mode = kDelegateArgsMode_Auto) = 0;
 
+  /// \brief    add delegate owned by intrusive handle to call list. If delegate was added more than one time, it will be called many times
+  /// \param    delegate - delegate handle
+  /// \param    tag - string tag. Tag is not unique, more than one delegates may be added with same tags
+  virtual void add(
+    DelegateHandle delegate,
+    const std::string& tag = std::string(),
+    DelegateArgsMode args_mode = kDelegateArgsMode_Auto) = 0;
+
   /// \brief    remove delegate from call list by tag. If more than one delegates were added with single tag, all of them will be removed
   /// \param    tag - string tag
   virtual void remove(const std::string& tag) = 0;
@@ -300,6 +967,10 @@ struct ISignal
   /// \param    delegate - pointer to delegate
   virtual void remove(std::shared_ptr<IDelegate> delegate) = 0;
 
+  /// \brief    remove delegate from call list by handle. Only delegates which added by handle will be removed
+  /// \param    delegate - delegate handle
+  virtual void remove(const DelegateHandle& delegate) = 0;
+
   /// \brief    remove all delegates from call list
   virtual void remove_all() = 0;
 
@@ -66,7 +66,7 @@ public:
     ///   struct MyStruct { int x; std::string y; };
     ///   BinarySerializer serializer;
     ///   serializer.register_custom_type(
-    ///       typeid(MyStruct).hash_code(),
+    ///       type_id<MyStruct>(),
     ///       [](const void* ptr, std::vector<uint8_t>& output) {
     ///           const MyStruct& s = *static_cast<const MyStruct*>(ptr);
     ///           // Serialize s.x and s.y to output...
@@ -104,7 +104,7 @@ public:
     void register_custom_type(
         std::function<bool(const T&, std::vector<uint8_t>&)> serialize_func,
         std::function<bool(const std::vector<uint8_t>&, size_t&, T&)> deserialize_func) {
-        size_t hash = typeid(T).hash_code();
+        size_t hash = type_id<T>();
         serializers_[hash] = [serialize_func](const void* ptr, std::vector<uint8_t>& output) {
             const T& value = *static_cast<const T*>(ptr);
             return serialize_func(value, output);
@@ -209,7 +209,7 @@ public:
     /// \brief    Register custom type serializer
     template<typename T>
     void register_type() {
-        size_t hash = typeid(T).hash_code();
+        size_t hash = type_id<T>();
         serializers_[hash] = [](const void* ptr, std::vector<uint8_t>& output) {
             const T& value = *static_cast<const T*>(ptr);
             return serialize_impl(value, output);
@@ -242,7 +242,7 @@ private:
     /// \brief    Register container implementation for std::vector
     template<typename T>
     void register_vector_impl() {
-        size_t hash = typeid(std::vector<T>).hash_code();
+        size_t hash = type_id<std::vector<T>>();
         serializers_[hash] = [](const void* ptr, std::vector<uint8_t>& output) {
             const std::vector<T>& container = *static_cast<const std::vector<T>*>(ptr);
             return serialize_vector_impl(container, output);
@@ -260,7 +260,7 @@ private:
     /// \brief    Register container implementation for std::list
     template<typename T>
     void register_list_impl() {
-        size_t hash = typeid(std::list<T>).hash_code();
+        size_t hash = type_id<std::list<T>>();
         serializers_[hash] = [](const void* ptr, std::vector<uint8_t>& output) {
             const std::list<T>& container = *static_cast<const std::list<T>*>(ptr);
             return serialize_list_impl(container, output);
@@ -1387,23 +1387,23 @@ private:
     bool deserialize_value_to_arg(size_t type_hash, const std::vector<uint8_t>& input,
                                  size_t& offset, IDelegateArgs* args, size_t idx) {
         // Match type hash to known types and deserialize
-        if (type_hash == typeid(int).hash_code()) {
+        if (type_hash == type_id<int>()) {
             return deserialize_and_set_arg<int>(input, offset, args, idx);
-        } else if (type_hash == typeid(long).hash_code()) {
+        } else if (type_hash == type_id<long>()) {
             return deserialize_and_set_arg<long>(input, offset, args, idx);
-        } else if (type_hash == typeid(long long).hash_code()) {
+        } else if (type_hash == type_id<long long>()) {
             return deserialize_and_set_arg<long long>(input, offset, args, idx);
-        } else if (type_hash == typeid(unsigned int).hash_code()) {
+        } else if (type_hash == type_id<unsigned int>()) {
             return deserialize_and_set_arg<unsigned int>(input, offset, args, idx);
-        } else if (type_hash == typeid(unsigned long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long>()) {
             return deserialize_and_set_arg<unsigned long>(input, offset, args, idx);
-        } else if (type_hash == typeid(unsigned long long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long long>()) {
             return deserialize_and_set_arg<unsigned long long>(input, offset, args, idx);
-        } else if (type_hash == typeid(float).hash_code()) {
+        } else if (type_hash == type_id<float>()) {
             return deserialize_and_set_arg<float>(input, offset, args, idx);
-        } else if (type_hash == typeid(double).hash_code()) {
+        } else if (type_hash == type_id<double>()) {
             return deserialize_and_set_arg<double>(input, offset, args, idx);
-        } else if (type_hash == typeid(bool).hash_code()) {
+        } else if (type_hash == type_id<bool>()) {
             // bool is serialized as int in msgpack-c
             int int_value;
             if (!deserialize_impl(input, offset, int_value)) {
@@ -1411,49 +1411,49 @@ private:
             }
             bool bool_value = (int_value != 0);
             return args->set<bool>(idx, bool_value);
-        } else if (type_hash == typeid(std::string).hash_code()) {
+        } else if (type_hash == type_id<std::string>()) {
             return deserialize_and_set_arg<std::string>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::wstring).hash_code()) {
+        } else if (type_hash == type_id<std::wstring>()) {
             return deserialize_and_set_arg<std::wstring>(input, offset, args, idx);
-        } else if (type_hash == typeid(char).hash_code()) {
+        } else if (type_hash == type_id<char>()) {
             return deserialize_and_set_arg<char>(input, offset, args, idx);
-        } else if (type_hash == typeid(uint8_t).hash_code()) {
+        } else if (type_hash == type_id<uint8_t>()) {
             // Note: unsigned char and uint8_t are the same type
             return deserialize_and_set_arg<uint8_t>(input, offset, args, idx);
-        } else if (type_hash == typeid(short).hash_code()) {
+        } else if (type_hash == type_id<short>()) {
             return deserialize_and_set_arg<short>(input, offset, args, idx);
-        } else if (type_hash == typeid(unsigned short).hash_code()) {
+        } else if (type_hash == type_id<unsigned short>()) {
             return deserialize_and_set_arg<unsigned short>(input, offset, args, idx);
         }
         
         // Check for container types - try common container types
-        if (type_hash == typeid(std::vector<int>).hash_code()) {
+        if (type_hash == type_id<std::vector<int>>()) {
             return deserialize_and_set_arg<std::vector<int>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::vector<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<std::string>>()) {
             return deserialize_and_set_arg<std::vector<std::string>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::list<int>).hash_code()) {
+        } else if (type_hash == type_id<std::list<int>>()) {
             return deserialize_and_set_arg<std::list<int>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::list<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::list<std::string>>()) {
             return deserialize_and_set_arg<std::list<std::string>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::vector<short>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<short>>()) {
             return deserialize_and_set_arg<std::vector<short>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::vector<float>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<float>>()) {
             return deserialize_and_set_arg<std::vector<float>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::vector<double>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<double>>()) {
             return deserialize_and_set_arg<std::vector<double>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::list<short>).hash_code()) {
+        } else if (type_hash == type_id<std::list<short>>()) {
             return deserialize_and_set_arg<std::list<short>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::list<float>).hash_code()) {
+        } else if (type_hash == type_id<std::list<float>>()) {
             return deserialize_and_set_arg<std::list<float>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::list<double>).hash_code()) {
+        } else if (type_hash == type_id<std::list<double>>()) {
             return deserialize_and_set_arg<std::list<double>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::vector<long>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<long>>()) {
             return deserialize_and_set_arg<std::vector<long>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::vector<unsigned int>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<unsigned int>>()) {
             return deserialize_and_set_arg<std::vector<unsigned int>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::list<long>).hash_code()) {
+        } else if (type_hash == type_id<std::list<long>>()) {
             return deserialize_and_set_arg<std::list<long>>(input, offset, args, idx);
-        } else if (type_hash == typeid(std::list<unsigned int>).hash_code()) {
+        } else if (type_hash == type_id<std::list<unsigned int>>()) {
             return deserialize_and_set_arg<std::list<unsigned int>>(input, offset, args, idx);
         }
         
@@ -1463,23 +1463,23 @@ private:
     bool deserialize_value_to_result(size_t type_hash, const std::vector<uint8_t>& input,
                                     size_t& offset, IDelegateResult* result) {
         // Match type hash to known types and deserialize
-        if (type_hash == typeid(int).hash_code()) {
+        if (type_hash == type_id<int>()) {
             return deserialize_and_set_result<int>(input, offset, result);
-        } else if (type_hash == typeid(long).hash_code()) {
+        } else if (type_hash == type_id<long>()) {
             return deserialize_and_set_result<long>(input, offset, result);
-        } else if (type_hash == typeid(long long).hash_code()) {
+        } else if (type_hash == type_id<long long>()) {
             return deserialize_and_set_result<long long>(input, offset, result);
-        } else if (type_hash == typeid(unsigned int).hash_code()) {
+        } else if (type_hash == type_id<unsigned int>()) {
             return deserialize_and_set_result<unsigned int>(input, offset, result);
-        } else if (type_hash == typeid(unsigned long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long>()) {
             return deserialize_and_set_result<unsigned long>(input, offset, result);
-        } else if (type_hash == typeid(unsigned long long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long long>()) {
             return deserialize_and_set_result<unsigned long long>(input, offset, result);
-        } else if (type_hash == typeid(float).hash_code()) {
+        } else if (type_hash == type_id<float>()) {
             return deserialize_and_set_result<float>(input, offset, result);
-        } else if (type_hash == typeid(double).hash_code()) {
+        } else if (type_hash == type_id<double>()) {
             return deserialize_and_set_result<double>(input, offset, result);
-        } else if (type_hash == typeid(bool).hash_code()) {
+        } else if (type_hash == type_id<bool>()) {
             // bool is serialized as int in msgpack-c
             int int_value;
             if (!deserialize_impl(input, offset, int_value)) {
@@ -1487,46 +1487,46 @@ private:
             }
             bool bool_value = (int_value != 0);
             return result->set<bool>(bool_value);
-        } else if (type_hash == typeid(std::string).hash_code()) {
+        } else if (type_hash == type_id<std::string>()) {
             return deserialize_and_set_result<std::string>(input, offset, result);
-        } else if (type_hash == typeid(std::wstring).hash_code()) {
+        } else if (type_hash == type_id<std::wstring>()) {
             return deserialize_and_set_result<std::wstring>(input, offset, result);
-        } else if (type_hash == typeid(char).hash_code()) {
+        } else if (type_hash == type_id<char>()) {
             return deserialize_and_set_result<char>(input, offset, result);
-        } else if (type_hash == typeid(uint8_t).hash_code()) {
+        } else if (type_hash == type_id<uint8_t>()) {
             // Note: unsigned char and uint8_t are the same type
             return deserialize_and_set_result<uint8_t>(input, offset, result);
-        } else if (type_hash == typeid(short).hash_code()) {
+        } else if (type_hash == type_id<short>()) {
             return deserialize_and_set_result<short>(input, offset, result);
-        } else if (type_hash == typeid(unsigned short).hash_code()) {
+        } else if (type_hash == type_id<unsigned short>()) {
             return deserialize_and_set_result<unsigned short>(input, offset, result);
-        } else if (type_hash == typeid(std::vector<int>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<int>>()) {
             return deserialize_and_set_result<std::vector<int>>(input, offset, result);
-        } else if (type_hash == typeid(std::vector<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<std::string>>()) {
             return deserialize_and_set_result<std::vector<std::string>>(input, offset, result);
-        } else if (type_hash == typeid(std::list<int>).hash_code()) {
+        } else if (type_hash == type_id<std::list<int>>()) {
             return deserialize_and_set_result<std::list<int>>(input, offset, result);
-        } else if (type_hash == typeid(std::list<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::list<std::string>>()) {
             return deserialize_and_set_result<std::list<std::string>>(input, offset, result);
-        } else if (type_hash == typeid(std::vector<short>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<short>>()) {
             return deserialize_and_set_result<std::vector<short>>(input, offset, result);
-        } else if (type_hash == typeid(std::vector<float>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<float>>()) {
             return deserialize_and_set_result<std::vector<float>>(input, offset, result);
-        } else if (type_hash == typeid(std::vector<double>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<double>>()) {
             return deserialize_and_set_result<std::vector<double>>(input, offset, result);
-        } else if (type_hash == typeid(std::list<short>).hash_code()) {
+        } else if (type_hash == type_id<std::list<short>>()) {
             return deserialize_and_set_result<std::list<short>>(input, offset, result);
-        } else if (type_hash == typeid(std::list<float>).hash_code()) {
+        } else if (type_hash == type_id<std::list<float>>()) {
             return deserialize_and_set_result<std::list<float>>(input, offset, result);
-        } else if (type_hash == typeid(std::list<double>).hash_code()) {
+        } else if (type_hash == type_id<std::list<double>>()) {
             return deserialize_and_set_result<std::list<double>>(input, offset, result);
-        } else if (type_hash == typeid(std::vector<long>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<long>>()) {
             return deserialize_and_set_result<std::vector<long>>(input, offset, result);
-        } else if (type_hash == typeid(std::vector<unsigned int>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<unsigned int>>()) {
             return deserialize_and_set_result<std::vector<unsigned int>>(input, offset, result);
-        } else if (type_hash == typeid(std::list<long>).hash_code()) {
+        } else if (type_hash == type_id<std::list<long>>()) {
             return deserialize_and_set_result<std::list<long>>(input, offset, result);
-        } else if (type_hash == typeid(std::list<unsigned int>).hash_code()) {
+        } else if (type_hash == type_id<std::list<unsigned int>>()) {
             return deserialize_and_set_result<std::list<unsigned int>>(input, offset, result);
         }
         return false;
@@ -197,7 +197,7 @@ public:
     template<typename T>
     typename std::enable_if<!std::is_same<T, std::wstring>::value, void>::type
     register_type() {
-        size_t hash = typeid(T).hash_code();
+        size_t hash = type_id<T>();
         serializers_[hash] = [](const void* ptr, nlohmann::json& json) {
             const T& value = *static_cast<const T*>(ptr);
             json = value;
@@ -214,7 +214,7 @@ public:
     template<typename T>
     typename std::enable_if<std::is_same<T, std::wstring>::value, void>::type
     register_type() {
-        size_t hash = typeid(std::wstring).hash_code();
+        size_t hash = type_id<std::wstring>();
         serializers_[hash] = [](const void* ptr, nlohmann::json& json) {
             const std::wstring& wstr = *static_cast<const std::wstring*>(ptr);
             // Convert wstring to UTF-8 string
@@ -435,44 +435,44 @@ private:
     bool deserialize_value_to_arg_impl(size_t type_hash, const nlohmann::json& json,
                                       IDelegateArgs* args, size_t idx) {
         // Match type hash to known types and deserialize
-        if (type_hash == typeid(int).hash_code()) {
+        if (type_hash == type_id<int>()) {
             return deserialize_and_set_arg<int>(json, args, idx);
-        } else if (type_hash == typeid(long).hash_code()) {
+        } else if (type_hash == type_id<long>()) {
             return deserialize_and_set_arg<long>(json, args, idx);
-        } else if (type_hash == typeid(long long).hash_code()) {
+        } else if (type_hash == type_id<long long>()) {
             return deserialize_and_set_arg<long long>(json, args, idx);
-        } else if (type_hash == typeid(unsigned int).hash_code()) {
+        } else if (type_hash == type_id<unsigned int>()) {
             return deserialize_and_set_arg<unsigned int>(json, args, idx);
-        } else if (type_hash == typeid(unsigned long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long>()) {
             return deserialize_and_set_arg<unsigned long>(json, args, idx);
-        } else if (type_hash == typeid(unsigned long long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long long>()) {
             return deserialize_and_set_arg<unsigned long long>(json, args, idx);
-        } else if (type_hash == typeid(float).hash_code()) {
+        } else if (type_hash == type_id<float>()) {
             return deserialize_and_set_arg<float>(json, args, idx);
-        } else if (type_hash == typeid(double).hash_code()) {
+        } else if (type_hash == type_id<double>()) {
             return deserialize_and_set_arg<double>(json, args, idx);
-        } else if (type_hash == typeid(bool).hash_code()) {
+        } else if (type_hash == type_id<bool>()) {
             return deserialize_and_set_arg<bool>(json, args, idx);
-        } else if (type_hash == typeid(std::string).hash_code()) {
+        } else if (type_hash == type_id<std::string>()) {
             return deserialize_and_set_arg<std::string>(json, args, idx);
-        } else if (type_hash == typeid(std::wstring).hash_code()) {
+        } else if (type_hash == type_id<std::wstring>()) {
             return deserialize_and_set_arg(json, args, idx, static_cast<std::wstring*>(nullptr));
-        } else if (type_hash == typeid(char).hash_code()) {
+        } else if (type_hash == type_id<char>()) {
             return deserialize_and_set_arg<char>(json, args, idx);
-        } else if (type_hash == typeid(uint8_t).hash_code()) {
+        } else if (type_hash == type_id<uint8_t>()) {
             // Note: unsigned char and uint8_t are the same type
             return deserialize_and_set_arg<uint8_t>(json, args, idx);
-        } else if (type_hash == typeid(short).hash_code()) {
+        } else if (type_hash == type_id<short>()) {
             return deserialize_and_set_arg<short>(json, args, idx);
-        } else if (type_hash == typeid(unsigned short).hash_code()) {
+        } else if (type_hash == type_id<unsigned short>()) {
             return deserialize_and_set_arg<unsigned short>(json, args, idx);
-        } else if (type_hash == typeid(std::vector<int>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<int>>()) {
             return deserialize_and_set_arg<std::vector<int>>(json, args, idx);
-        } else if (type_hash == typeid(std::vector<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<std::string>>()) {
             return deserialize_and_set_arg<std::vector<std::string>>(json, args, idx);
-        } else if (type_hash == typeid(std::list<int>).hash_code()) {
+        } else if (type_hash == type_id<std::list<int>>()) {
             return deserialize_and_set_arg<std::list<int>>(json, args, idx);
-        } else if (type_hash == typeid(std::list<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::list<std::string>>()) {
             return deserialize_and_set_arg<std::list<std::string>>(json, args, idx);
         }
         return false;
@@ -481,44 +481,44 @@ private:
     bool deserialize_value_to_result_impl(size_t type_hash, const nlohmann::json& json,
                                          IDelegateResult* result) {
         // Match type hash to known types and deserialize
-        if (type_hash == typeid(int).hash_code()) {
+        if (type_hash == type_id<int>()) {
             return deserialize_and_set_result<int>(json, result);
-        } else if (type_hash == typeid(long).hash_code()) {
+        } else if (type_hash == type_id<long>()) {
             return deserialize_and_set_result<long>(json, result);
-        } else if (type_hash == typeid(long long).hash_code()) {
+        } else if (type_hash == type_id<long long>()) {
             return deserialize_and_set_result<long long>(json, result);
-        } else if (type_hash == typeid(unsigned int).hash_code()) {
+        } else if (type_hash == type_id<unsigned int>()) {
             return deserialize_and_set_result<unsigned int>(json, result);
-        } else if (type_hash == typeid(unsigned long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long>()) {
             return deserialize_and_set_result<unsigned long>(json, result);
-        } else if (type_hash == typeid(unsigned long long).hash_code()) {
+        } else if (type_hash == type_id<unsigned long long>()) {
             return deserialize_and_set_result<unsigned long long>(json, result);
-        } else if (type_hash == typeid(float).hash_code()) {
+        } else if (type_hash == type_id<float>()) {
             return deserialize_and_set_result<float>(json, result);
-        } else if (type_hash == typeid(double).hash_code()) {
+        } else if (type_hash == type_id<double>()) {
             return deserialize_and_set_result<double>(json, result);
-        } else if (type_hash == typeid(bool).hash_code()) {
+        } else if (type_hash == type_id<bool>()) {
             return deserialize_and_set_result<bool>(json, result);
-        } else if (type_hash == typeid(std::string).hash_code()) {
+        } else if (type_hash == type_id<std::string>()) {
             return deserialize_and_set_result<std::string>(json, result);
-        } else if (type_hash == typeid(std::wstring).hash_code()) {
+        } else if (type_hash == type_id<std::wstring>()) {
             return deserialize_and_set_result(json, result, static_cast<std::wstring*>(nullptr));
-        } else if (type_hash == typeid(char).hash_code()) {
+        } else if (type_hash == type_id<char>()) {
             return deserialize_and_set_result<char>(json, result);
-        } else if (type_hash == typeid(uint8_t).hash_code()) {
+        } else if (type_hash == type_id<uint8_t>()) {
             // Note: unsigned char and uint8_t are the same type
             return deserialize_and_set_result<uint8_t>(json, result);
-        } else if (type_hash == typeid(short).hash_code()) {
+        } else if (type_hash == type_id<short>()) {
             return deserialize_and_set_result<short>(json, result);
-        } else if (type_hash == typeid(unsigned short).hash_code()) {
+        } else if (type_hash == type_id<unsigned short>()) {
             return deserialize_and_set_result<unsigned short>(json, result);
-        } else if (type_hash == typeid(std::vector<int>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<int>>()) {
             return deserialize_and_set_result<std::vector<int>>(json, result);
-        } else if (type_hash == typeid(std::vector<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::vector<std::string>>()) {
             return deserialize_and_set_result<std::vector<std::string>>(json, result);
-        } else if (type_hash == typeid(std::list<int>).hash_code()) {
+        } else if (type_hash == type_id<std::list<int>>()) {
             return deserialize_and_set_result<std::list<int>>(json, result);
-        } else if (type_hash == typeid(std::list<std::string>).hash_code()) {
+        } else if (type_hash == type_id<std::list<std::string>>()) {
             return deserialize_and_set_result<std::list<std::string>>(json, result);
         }
         return false;
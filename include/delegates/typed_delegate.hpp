@@ -34,6 +34,28 @@ DELEGATES_BASE_NAMESPACE_BEGIN
 
 namespace delegates {
 
+/// \brief    Typed handle of asynchronous call started by TypedDelegate::call_async()
+template<typename Result>
+class TypedDelegateFuture : public DelegateFuture {
+public:
+    TypedDelegateFuture() noexcept = default;
+    explicit TypedDelegateFuture(DelegateFuture future) noexcept : DelegateFuture(future) {}
+    
+    /// \brief    Wait for call completion and move result value out
+    template<typename T = Result>
+    typename std::enable_if<!std::is_void<T>::value, typename std::decay<T>::type>::type get() {
+        return DelegateFuture::get<typename std::decay<T>::type>();
+    }
+    
+    /// \brief    Wait for call completion (void specialization)
+    template<typename T = Result>
+    typename std::enable_if<std::is_void<T>::value, void>::type get() {
+        if (!wait()) {
+            DELEGATES_THROW(std::runtime_error("TypedDelegate: asynchronous call failed"));
+        }
+    }
+};
+
 /// \brief    Typed wrapper for IDelegate providing convenient direct call API
 ///           while preserving access to untyped interface for executors
 template<typename Result, typename... Args>
@@ -43,32 +65,47 @@ public:
     TypedDelegate(IDelegate* delegate, bool owns = false)
         : delegate_(delegate), owns_(owns) {
         if (!delegate_) {
-            throw std::invalid_argument("TypedDelegate: delegate cannot be null");
+            DELEGATES_THROW(std::invalid_argument("TypedDelegate: delegate cannot be null"));
         }
+        invoker_ = delegate_->invoker<Result, Args...>();
     }
     
     /// \brief    Construct from unique_ptr (takes ownership)
     TypedDelegate(std::unique_ptr<IDelegate> delegate)
         : delegate_(delegate.release()), owns_(true) {
         if (!delegate_) {
-            throw std::invalid_argument("TypedDelegate: delegate cannot be null");
+            DELEGATES_THROW(std::invalid_argument("TypedDelegate: delegate cannot be null"));
         }
+        invoker_ = delegate_->invoker<Result, Args...>();
     }
     
     /// \brief    Construct from shared_ptr (shares ownership)
     TypedDelegate(std::shared_ptr<IDelegate> delegate)
         : delegate_(delegate.get()), shared_(delegate) {
         if (!delegate_) {
-            throw std::invalid_argument("TypedDelegate: delegate cannot be null");
+            DELEGATES_THROW(std::invalid_argument("TypedDelegate: delegate cannot be null"));
+        }
+        invoker_ = delegate_->invoker<Result, Args...>();
+    }
+    
+    /// \brief    Construct from intrusive handle (shares ownership)
+    TypedDelegate(DelegateHandle delegate)
+        : delegate_(delegate.get()), handle_(std::move(delegate)) {
+        if (!delegate_) {
+            DELEGATES_THROW(std::invalid_argument("TypedDelegate: delegate cannot be null"));
         }
+        invoker_ = delegate_->invoker<Result, Args...>();
     }
     
     /// \brief    Move constructor
     TypedDelegate(TypedDelegate&& other) noexcept
         : delegate_(other.delegate_)
+        , invoker_(other.invoker_)
         , owns_(other.owns_)
-        , shared_(std::move(other.shared_)) {
+        , shared_(std::move(other.shared_))
+        , handle_(std::move(other.handle_)) {
         other.delegate_ = nullptr;
+        other.invoker_ = nullptr;
         other.owns_ = false;
     }
     
@@ -77,9 +114,12 @@ public:
         if (this != &other) {
             cleanup();
             delegate_ = other.delegate_;
+            invoker_ = other.invoker_;
             owns_ = other.owns_;
             shared_ = std::move(other.shared_);
+            handle_ = std::move(other.handle_);
             other.delegate_ = nullptr;
+            other.invoker_ = nullptr;
             other.owns_ = false;
         }
         return *this;
@@ -103,11 +143,33 @@ public:
         set_args(std::forward<Args>(args)...);
         bool success = delegate_->call();
         if (!success) {
-            throw std::runtime_error("TypedDelegate: call failed");
+            DELEGATES_THROW(std::runtime_error("TypedDelegate: call failed"));
         }
         return get_result();
     }
     
+    /// \brief    Direct call: arguments are forwarded straight to delegate target and result is returned from it,
+    ///           no copies to arguments storage or result buffer are made. Stored arguments and result are not changed
+    /// \note     Falls back to operator() when delegate does not support direct call (e.g. signal)
+    Result invoke(Args... args) {
+        if (invoker_)
+            return invoker_->invoke(std::forward<Args>(args)...);
+        return (*this)(std::forward<Args>(args)...);
+    }
+    
+    /// \brief    Store arguments and post call to executor, see IDelegate::call_async()
+    /// \param    executor - callable which accepts task (callable without arguments)
+    /// \param    call_args - Arguments to pass to the delegate
+    /// \return   Call handle, get() waits for completion and returns result
+    template<typename TExecutor>
+    TypedDelegateFuture<Result> call_async(TExecutor&& executor, Args... args) {
+        set_args(std::forward<Args>(args)...);
+        return TypedDelegateFuture<Result>(delegate_->call_async(std::forward<TExecutor>(executor)));
+    }
+    
+    /// \brief    Check if direct call is supported by delegate, so invoke() does not use arguments storage
+    bool has_direct_call() const { return invoker_ != nullptr; }
+    
     /// \brief    Get untyped interface (for executor)
     /// \return   Raw IDelegate* pointer for type-agnostic execution
     /// \note     Executors can use this to work with delegates without knowing their types.
@@ -138,12 +200,28 @@ public:
     /// \brief    Call with external arguments
     bool call(IDelegateArgs* args) { return delegate_->call(args); }
     
-    /// \brief    Get result
+    /// \brief    Reentrant call with caller owned DelegateCallFrame<Result, Args...>
+    bool call(IDelegateCallFrame& frame) { return delegate_->call(frame); }
+    
+    /// \brief    Get result copy
     template<typename T = Result>
-    typename std::enable_if<!std::is_void<T>::value, T>::type get_result() {
+    typename std::enable_if<!std::is_void<T>::value && std::is_copy_constructible<T>::value, T>::type get_result() {
         return delegate_->result()->get<T>();
     }
     
+    /// \brief    Get result of move-only type (e.g. std::unique_ptr). Value is moved out, result becomes empty
+    template<typename T = Result>
+    typename std::enable_if<!std::is_void<T>::value && !std::is_copy_constructible<T>::value, T>::type get_result() {
+        return delegate_->result()->take<T>();
+    }
+    
+    /// \brief    Move result value out, result becomes empty. Large results (e.g. containers) are not copied
+    ///           and memory held by result is not pinned by delegate until next call
+    template<typename T = Result>
+    typename std::enable_if<!std::is_void<T>::value, typename std::decay<T>::type>::type take_result() {
+        return delegate_->result()->take<typename std::decay<T>::type>();
+    }
+    
     /// \brief    Get result (void specialization)
     template<typename T = Result>
     typename std::enable_if<std::is_void<T>::value, void>::type get_result() {
@@ -175,21 +253,35 @@ private:
     template<size_t... Is>
     void set_args_impl(std::index_sequence<Is...>, Args... args) {
         // C++14 compatible: use array initialization trick instead of fold expression
-        // Store arguments in tuple for indexed access
-        auto args_tuple = std::make_tuple(args...);
         using array_type = int[];
-        (void)array_type{0, (set_arg_by_index<Is>(std::get<Is>(args_tuple)), 0)...};
+        (void)array_type{0, (set_arg_by_index<Is>(args), 0)...};
     }
     
     template<size_t I>
-    void set_arg_by_index(typename std::tuple_element<I, std::tuple<Args...>>::type arg) {
-        using arg_type = typename std::decay<typename std::tuple_element<I, std::tuple<Args...>>::type>::type;
-        delegate_->args()->set<arg_type>(I, arg);
+    void set_arg_by_index(typename std::tuple_element<I, std::tuple<Args...>>::type& arg) {
+        using arg_orig_type = typename std::tuple_element<I, std::tuple<Args...>>::type;
+        using arg_type = typename std::decay<arg_orig_type>::type;
+        set_arg_value<arg_type>(I, arg, std::integral_constant<bool,
+            std::is_reference<arg_orig_type>::value || std::is_const<arg_orig_type>::value>());
+    }
+    
+    /// \brief    Reference or const argument is copied to arguments storage
+    template<typename T>
+    void set_arg_value(size_t idx, const T& arg, std::true_type) {
+        delegate_->args()->set<T>(idx, arg);
+    }
+    
+    /// \brief    By-value argument is owned by this call, so it is moved to arguments storage (move-only types are supported)
+    template<typename T>
+    void set_arg_value(size_t idx, T& arg, std::false_type) {
+        delegate_->args()->set(idx, std::move(arg));
     }
     
     IDelegate* delegate_ = nullptr;
+    IDelegateInvoke<Result, Args...>* invoker_ = nullptr;  // direct call interface of delegate_, if supported
     bool owns_ = false;
     std::shared_ptr<IDelegate> shared_;  // For shared_ptr ownership
+    DelegateHandle handle_;  // For intrusive handle ownership
 };
 
 } // namespace delegates
@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2025, Alex Bobryshev <alexbobryshev555@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Tests for build profile without RTTI and exceptions (-fno-rtti -fno-exceptions)
+// All errors must be reported by return codes
+
+#include "gtest/gtest.h"
+
+#include <delegates/delegates.hpp>
+#include <string>
+
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+#error "RTTI must be disabled for this test"
+#endif
+
+static_assert(DELEGATES_EXCEPTIONS == 0, "Exceptions must be disabled for this test");
+static_assert(DELEGATES_STRICT == 0, "Strict mode can't be used without exceptions");
+
+USING_DELEGATES_BASE_NAMESPACE
+using namespace DELEGATES_BASE_NAMESPACE::delegates;
+
+namespace {
+
+int add(int a, int b) { return a + b; }
+
+}
+
+TEST(NoRttiNoExceptionsTests, ArgsErrorsByReturnCodes) {
+  DelegateArgs<int, std::string> args;
+
+  ASSERT_TRUE(args.set<int>(0, 5));
+  ASSERT_TRUE(args.set<std::string>(1, "hello"));
+  ASSERT_EQ(args.get<int>(0), 5);
+
+  // wrong type
+  ASSERT_FALSE(args.set<float>(0, 1.0f));
+
+  // out of range index
+  ASSERT_FALSE(args.set<int>(2, 1));
+  ASSERT_EQ(args.hash_code(2), 0);
+  ASSERT_TRUE(args.get_ptr(2) == nullptr);
+
+  float out = 0;
+  ASSERT_FALSE(args.try_get<float>(0, out));
+  ASSERT_EQ(args.hash_code(0), type_id<int>());
+}
+
+TEST(NoRttiNoExceptionsTests, DelegateCall) {
+  std::unique_ptr<IDelegate> call = factory::make_unique(&add, 1, 2);
+  ASSERT_TRUE(call->call());
+  ASSERT_EQ(call->result()->get<int>(), 3);
+
+  // arguments with wrong types are rejected by call()
+  DelegateArgs<int, float> wrong_args(1, 2.0f);
+  ASSERT_FALSE(call->call(&wrong_args));
+
+  float f = 0;
+  ASSERT_FALSE(call->result()->try_get<float>(f));
+}
+
+TEST(NoRttiNoExceptionsTests, SignalAndTypedDelegate) {
+  Signal<int, int> sig;
+  sig += factory::make_shared<int, int>([](int v) { return v * 2; });
+  sig.args()->set<int>(0, 21);
+  ASSERT_TRUE(sig.call());
+  ASSERT_EQ(sig.result()->get<int>(), 42);
+
+  auto typed = factory::make_delegate_auto([](const std::string& s) { return s.size(); });
+  ASSERT_EQ(typed(std::string("four")), 4u);
+}
@@ -24,9 +24,16 @@
 
 #include <delegates/delegates.hpp>
 #include <algorithm>
+#include <atomic>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <set>
+
+#if defined(__cpp_impl_coroutine)
+#include <delegates/coroutine.hpp>
+#include <future>
+#endif
 
 #ifdef DELEGATES_WITH_JSON_SERIALIZATION
 #include <delegates/serialization/json_serializer.hpp>
@@ -43,6 +50,67 @@
 USING_DELEGATES_BASE_NAMESPACE
 using namespace DELEGATES_BASE_NAMESPACE::delegates;
 
+TEST_F(DeferredCallTests, TypeId_CompileTime) {
+  // identifiers are compile-time constants
+  static_assert(type_id<int>() != 0, "type id must be non-zero");
+  static_assert(type_id<int>() == type_id<const int&>(), "references and cv-qualifiers are ignored");
+  static_assert(type_id<std::string>() == type_id<std::string&>(), "references are ignored");
+  static_assert(type_id<int>() != type_id<unsigned int>(), "different types have different ids");
+  static_assert(type_id<int*>() != type_id<const int*>(), "pointee cv-qualifiers are not ignored");
+  static_assert(type_id<std::vector<int> >() != type_id<std::vector<long> >(), "template arguments are part of id");
+
+  // closures have no unique names, so they are detected and rejected as arguments and results
+  auto closure = [](int v) { return v; };
+  static_assert(is_unnamed_type<decltype(closure)>::value, "closure type is detected");
+  static_assert(is_unnamed_type<const decltype(closure)&>::value, "closure type is detected through reference");
+  static_assert(!is_unnamed_type<std::string>::value, "named type is not closure");
+  static_assert(!is_unnamed_type<std::function<int(int)> >::value, "std::function is not closure");
+  (void)closure;
+
+  DelegateArgs<const std::string&, int*> args;
+  ASSERT_EQ(args.hash_code(0), type_id<std::string>());
+  ASSERT_EQ(args.hash_code(1), type_id<int*>());
+
+  DelegateResult<std::vector<int> > result;
+  ASSERT_EQ(result.hash_code(), type_id<std::vector<int> >());
+}
+
+TEST_F(DeferredCallTests, DelegateArgs_Signature) {
+  static_assert(signature_id<int, float>() == signature_id<const int&, float&>(), "references are ignored");
+  static_assert(signature_id<int, float>() != signature_id<float, int>(), "order matters");
+  static_assert(signature_id<int>() != signature_id<int, int>(), "count matters");
+  static_assert(signature_id<>() != signature_id<int>(), "empty list has own fingerprint");
+
+  DelegateArgs<int, const std::string&> args1;
+  DelegateArgs<int, std::string> args2;
+  DelegateArgs<int, int> args3;
+  DelegateArgs<> args4;
+  ASSERT_EQ(args1.signature(), (signature_id<int, std::string>()));
+  ASSERT_EQ(args1.signature(), args2.signature());
+  ASSERT_NE(args1.signature(), args3.signature());
+  ASSERT_EQ(args4.signature(), signature_id<>());
+
+  int called = 0;
+  auto call = delegates::factory::make_unique<void, int, std::string>([&called](int n, std::string s) { called = n + static_cast<int>(s.size()); });
+  ASSERT_EQ(call->args()->signature(), args2.signature());
+
+  args2.set<int>(0, 1);
+  args2.set<std::string>(1, "abc");
+  ASSERT_TRUE(call->call(&args2));
+  ASSERT_EQ(called, 4);
+  ASSERT_FALSE(call->call(&args3));
+  ASSERT_FALSE(call->call(&args4));
+
+  // slot with different signature uses its own arguments
+  Signal<void, int, int> sig;
+  sig.add(call.get());
+  call->args()->set<int>(0, 10);
+  call->args()->set<std::string>(1, "a");
+  ASSERT_TRUE(sig.call());
+  ASSERT_EQ(called, 11);
+  sig.remove_all();
+}
+
 TEST_F(DeferredCallTests, DelegateArgs_SimpleValues) {
   // with default arguments
   DelegateArgs<int, float> args1;
@@ -57,8 +125,8 @@ TEST_F(DeferredCallTests, DelegateArgs_SimpleValues) {
   ASSERT_EQ(args1.get<int>(0), 123);
   ASSERT_EQ(args1.get<float>(1), 1.23f);
 
-  ASSERT_EQ(args1.hash_code(0), typeid(int).hash_code());
-  ASSERT_EQ(args1.hash_code(1), typeid(float).hash_code());
+  ASSERT_EQ(args1.hash_code(0), type_id<int>());
+  ASSERT_EQ(args1.hash_code(1), type_id<float>());
 
   args1.clear();
 
@@ -108,8 +176,8 @@ TEST_F(DeferredCallTests, DelegateArgs_StringsVectors) {
   ASSERT_EQ(ta[0], 1);
   ASSERT_EQ(ta[1], 2);
 
-  ASSERT_EQ(args1.hash_code(0), typeid(std::string).hash_code());
-  ASSERT_EQ(args1.hash_code(1), typeid(std::vector<int>).hash_code());
+  ASSERT_EQ(args1.hash_code(0), type_id<std::string>());
+  ASSERT_EQ(args1.hash_code(1), type_id<std::vector<int>>());
 
   args1.clear();
 
@@ -117,6 +185,57 @@ TEST_F(DeferredCallTests, DelegateArgs_StringsVectors) {
   ASSERT_TRUE(args1.get<std::vector<int> >(1).size() == 0);
 }
 
+TEST_F(DeferredCallTests, DelegateArgs_MoveAndEmplace) {
+  DelegateArgs<std::vector<int>, std::string> args;
+
+  std::vector<int> payload(1024, 7);
+  const int* payload_data = payload.data();
+
+  // rvalue is moved into arguments storage, buffer is not copied
+  ASSERT_TRUE(args.set(0, std::move(payload)));
+  ASSERT_EQ(args.get_ref<std::vector<int> >(0).data(), payload_data);
+  ASSERT_EQ(args.get_ref<std::vector<int> >(0).size(), 1024);
+
+  std::vector<int> other(16, 1);
+  const int* other_data = other.data();
+  ASSERT_TRUE(args.set_move_ptr(0, &other, type_id<std::vector<int>>()));
+  ASSERT_EQ(args.get_ref<std::vector<int> >(0).data(), other_data);
+
+  ASSERT_TRUE(args.emplace<std::string>(1, 5, 'x'));
+  ASSERT_EQ(args.get<std::string>(1), "xxxxx");
+
+  // type is still checked
+  ASSERT_FALSE(args.emplace<std::vector<char> >(0, 3, 'a'));
+  ASSERT_FALSE(args.set(1, std::vector<int>{ 1 }));
+}
+
+TEST_F(DeferredCallTests, DelegateArgs_MoveOnly) {
+  using buffer_ptr = std::unique_ptr<std::vector<int> >;
+
+  size_t received = 0;
+  std::unique_ptr<IDelegate> call = delegates::factory::make_unique<void, buffer_ptr, int>(
+    [&received](buffer_ptr buf, int add) { received = buf ? buf->size() + add : 0; });
+
+  buffer_ptr buf(new std::vector<int>(100));
+  // move-only argument can't be copied
+  ASSERT_FALSE(call->args()->set_ptr(0, &buf, type_id<buffer_ptr>()));
+  ASSERT_TRUE(buf != nullptr);
+
+  ASSERT_TRUE(call->args()->set(0, std::move(buf)));
+  ASSERT_TRUE(buf == nullptr);
+  ASSERT_TRUE(call->args()->set<int>(1, 5));
+
+  // argument is moved out of storage on invocation
+  ASSERT_TRUE(call->call());
+  ASSERT_EQ(received, 105);
+  ASSERT_TRUE(call->args()->get_ref<buffer_ptr>(0) == nullptr);
+  ASSERT_EQ(call->args()->get<int>(1), 5);
+
+  // typed call moves arguments through
+  auto typed = delegates::factory::make_delegate<size_t, buffer_ptr>([](buffer_ptr b) { return b->size(); });
+  ASSERT_EQ(typed(buffer_ptr(new std::vector<int>(42))), 42);
+}
+
 TEST_F(DeferredCallTests, DelegateArgs_StringRef) {
   DelegateArgs<const std::string&> args1;
   ASSERT_EQ(args1.size(), 1);
@@ -201,9 +320,9 @@ TEST_F(DeferredCallTests, TestFunction) {
   ASSERT_TRUE(a == 1);
 
   ASSERT_EQ(3, call->args()->size());
-  ASSERT_EQ(typeid(int*).hash_code(), call->args()->hash_code(0));
-  ASSERT_EQ(typeid(int*).hash_code(), call->args()->hash_code(1));
-  ASSERT_EQ(typeid(int*).hash_code(), call->args()->hash_code(2));
+  ASSERT_EQ(type_id<int*>(), call->args()->hash_code(0));
+  ASSERT_EQ(type_id<int*>(), call->args()->hash_code(1));
+  ASSERT_EQ(type_id<int*>(), call->args()->hash_code(2));
 
   int *pa = *reinterpret_cast<int**>(call->args()->get_ptr(0));
   ASSERT_EQ(pa, &a);
@@ -223,7 +342,7 @@ TEST_F(DeferredCallTests, TestFunction) {
 
   int* pd = &d;
   a = 1; b = 2; c = 3;
-  call->args()->set_ptr(2, &pd, typeid(int*).hash_code());
+  call->args()->set_ptr(2, &pd, type_id<int*>());
 
   ret = call->call();
   ASSERT_TRUE(ret);
@@ -289,6 +408,33 @@ TEST_F(DeferredCallTests, TestLambda) {
   delete call4;
 }
 
+TEST_F(DeferredCallTests, TestLambda_VoidDelegateIgnoresLambdaResult) {
+  // default TResult is void, value returned by lambda is discarded
+  int called = 0;
+  std::unique_ptr<IDelegate> call(factory::make([&called](int x) { called += x; return x; }, 2));
+  ASSERT_TRUE(call->call());
+  ASSERT_EQ(called, 2);
+  ASSERT_EQ(call->result()->hash_code(), type_id<void>());
+
+  std::shared_ptr<IDelegate> shared = factory::make_shared([&called](int x) { called += x; return x; }, 3);
+  ASSERT_TRUE(shared->call());
+  ASSERT_EQ(called, 5);
+}
+
+TEST_F(DeferredCallTests, TestLambda_MoveOnlyMutableCapture) {
+  // lambda is stored inside delegate as is, so move-only captures are allowed and state is kept between calls
+  auto counter = std::unique_ptr<int>(new int(40));
+  auto call = delegates::factory::make_lambda_delegate<int, int>(
+    [counter = std::move(counter)](int a) mutable -> int { *counter += a; return *counter; },
+    delegates::DelegateArgs<int>(1));
+
+  ASSERT_TRUE(call->call());
+  ASSERT_EQ(call->result()->get<int>(), 41);
+  ASSERT_TRUE(call->call());
+  ASSERT_EQ(call->result()->get<int>(), 42);
+  delete call;
+}
+
 TEST_F(DeferredCallTests, TestClassMemberCall_ValueArg) {
   static const std::string kTestValue = "hello";
 
@@ -570,6 +716,41 @@ TEST_F(DeferredCallTests, TestLambda_CallArgDeleter) {
   ASSERT_EQ(deleted_b, 1);
 }
 
+TEST_F(DeferredCallTests, TestLambda_CapturingArgDeleter) {
+  auto deleted = std::make_shared<int>(0);
+  auto call = delegates::factory::make_lambda_delegate<void, int>([](int) {});
+
+  // capturing deleter owns its state until it is called or released
+  ASSERT_TRUE(call->args()->set<int>(0, 5, [deleted](int& v) { *deleted += v; }));
+  ASSERT_EQ(deleted.use_count(), 2);
+
+  call->args()->clear(0);
+  ASSERT_EQ(*deleted, 5);
+  ASSERT_EQ(deleted.use_count(), 1);
+
+  // deleter is released without call when value was not set
+  ASSERT_FALSE(call->args()->set<char>(0, 'a', [deleted](char&) { *deleted = -1; }));
+  ASSERT_EQ(*deleted, 5);
+  ASSERT_EQ(deleted.use_count(), 1);
+
+  // empty deleter
+  DelegateDeleter empty;
+  ASSERT_FALSE(empty);
+  ASSERT_TRUE(call->args()->set_ptr(0, &*deleted, type_id<int>(), std::move(empty)));
+  delete call;
+  ASSERT_EQ(deleted.use_count(), 1);
+
+  // empty std::function gives empty deleter, it is not called on reset or destruction
+  auto call2 = delegates::factory::make_lambda_delegate<void, int>([](int) {});
+  int v = 7;
+  ASSERT_TRUE(call2->args()->set(0, v, std::function<void(int&)>()));
+  ASSERT_FALSE(DelegateDeleter(std::function<void(void*)>()));
+  ASSERT_FALSE(DelegateDeleter::make<int>(std::function<void(int&)>()));
+  call2->reset();
+  ASSERT_TRUE(call2->args()->set(0, v, std::function<void(int&)>()));
+  delete call2;
+}
+
 
 TEST_F(DeferredCallTests, TestLambda_SetWrongArgType) {
   char a = 1;
@@ -927,6 +1108,71 @@ TEST_F(DeferredCallTests, TestDelegates_MultiCalls_RefParamsWithRefResult) {
   ASSERT_EQ(g_delegates_multicalls_test_result_instances, 1);
 }
 
+TEST_F(DeferredCallTests, TestDelegates_NonDefaultConstructibleResult) {
+  struct Counted {
+    explicit Counted(int v) : v_(v) { alive()++; }
+    Counted(const Counted& other) : v_(other.v_) { alive()++; }
+    ~Counted() { alive()--; }
+    static int& alive() { static int n = 0; return n; }
+    int v_;
+  };
+
+  Counted::alive() = 0;
+  {
+    auto call = delegates::factory::make_unique<Counted, int>([](int v) { return Counted(v); });
+    // no value is constructed until result is set
+    ASSERT_EQ(Counted::alive(), 0);
+
+    call->args()->set<int>(0, 7);
+    ASSERT_TRUE(call->call());
+    ASSERT_EQ(Counted::alive(), 1);
+    ASSERT_EQ(reinterpret_cast<const Counted*>(call->result()->get_ptr())->v_, 7);
+
+    call->result()->clear();
+    ASSERT_EQ(Counted::alive(), 0);
+    ASSERT_TRUE(call->result()->get_ptr() == nullptr);
+
+    ASSERT_TRUE(call->call());
+    ASSERT_EQ(Counted::alive(), 1);
+  }
+  ASSERT_EQ(Counted::alive(), 0);
+}
+
+TEST_F(DeferredCallTests, TestDelegates_SignalResult_MovedWithoutCopies) {
+  struct Payload {
+    Payload() = default;
+    explicit Payload(size_t n) : data_(n, 1) {}
+    Payload(const Payload& other) : data_(other.data_) { copies()++; }
+    Payload(Payload&& other) noexcept : data_(std::move(other.data_)) {}
+    Payload& operator=(const Payload& other) { data_ = other.data_; copies()++; return *this; }
+    Payload& operator=(Payload&& other) noexcept { data_ = std::move(other.data_); return *this; }
+    static int& copies() { static int n = 0; return n; }
+    std::vector<int> data_;
+  };
+
+  Payload::copies() = 0;
+  auto sig = delegates::factory::make_unique_signal<Payload, int>();
+  auto call = delegates::factory::make_shared<Payload, int>([](int n) { return Payload(static_cast<size_t>(n)); });
+  sig->add(call);
+
+  sig->args()->set<int>(0, 4096);
+  ASSERT_TRUE(sig->call());
+
+  // slot result is moved to slot result storage, then to signal result
+  ASSERT_FALSE(call->result()->has_value());
+  ASSERT_TRUE(sig->result()->has_value());
+  ASSERT_EQ(reinterpret_cast<const Payload*>(sig->result()->get_ptr())->data_.size(), 4096);
+  ASSERT_EQ(Payload::copies(), 0);
+
+  // detach moves value to caller buffer together with deleter
+  Payload out;
+  DelegateDeleter deleter;
+  ASSERT_TRUE(sig->result()->detach_ptr(&out, sizeof(out), deleter));
+  ASSERT_EQ(out.data_.size(), 4096);
+  ASSERT_FALSE(sig->result()->has_value());
+  ASSERT_EQ(Payload::copies(), 0);
+}
+
 TEST_F(DeferredCallTests, TestDelegates_SignalCalls_Remove) {
   static const std::string& kTestValue = "hello";
   auto sig = delegates::factory::make_unique_signal<void, int, const std::string&>();
@@ -1052,6 +1298,634 @@ TEST_F(DeferredCallTests, TestDelegates_SignalCalls_Remove) {
   call2.reset();
 }
 
+TEST_F(DeferredCallTests, TestDelegates_PoolAllocator) {
+  struct Calc {
+    int add(int a, int b) { return a + b; }
+  };
+
+  DelegatePool pool(8);
+  DelegatePoolAllocator<IDelegate> alloc(pool);
+
+  // blocks are reused after delegates are released
+  void* first = nullptr;
+  for (int i = 0; i < 100; i++) {
+    auto d = delegates::factory::allocate_shared<int, int>(alloc, [i](int v) { return v + i; });
+    d->args()->set<int>(0, 1);
+    ASSERT_TRUE(d->call());
+    ASSERT_EQ(d->result()->get<int>(), i + 1);
+    if (!first)
+      first = d.get();
+    ASSERT_EQ(first, d.get());
+  }
+
+  Calc calc;
+  auto m = delegates::factory::allocate_shared(alloc, &calc, &Calc::add, 2, 3);
+  ASSERT_TRUE(m->call());
+  ASSERT_EQ(m->result()->get<int>(), 5);
+
+  auto sig = delegates::factory::allocate_shared_signal<int, int, int>(alloc);
+  sig->add(m);
+  sig->args()->set<int>(0, 4);
+  sig->args()->set<int>(1, 6);
+  ASSERT_TRUE(sig->call());
+  ASSERT_EQ(sig->result()->get<int>(), 10);
+
+  // large and small blocks
+  void* big = pool.allocate(4096);
+  void* small = pool.allocate(24);
+  pool.deallocate(small, 24);
+  ASSERT_EQ(pool.allocate(20), small);
+  pool.deallocate(small, 20);
+  pool.deallocate(big, 4096);
+
+  // over-aligned blocks are not pooled, but keep requested alignment
+  struct alignas(64) Aligned {
+    char data_[64];
+  };
+  DelegatePoolAllocator<Aligned> aligned_alloc(pool);
+  Aligned* aligned = aligned_alloc.allocate(1);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0u);
+  aligned_alloc.deallocate(aligned, 1);
+}
+
+TEST_F(DeferredCallTests, TestDelegates_RebindAndReset) {
+  struct Counter {
+    int base_ = 0;
+    int add(int v) { return base_ + v; }
+    int sub(int v) { return base_ - v; }
+  };
+
+  Counter c1{ 10 };
+  Counter c2{ 100 };
+  MethodDelegate<Counter, int, int> method(&c1, &Counter::add, DelegateArgs<int>(1));
+  IDelegateArgs* args = method.args();
+  IDelegateResult* result = method.result();
+  ASSERT_TRUE(method.call());
+  ASSERT_EQ(method.result()->get<int>(), 11);
+
+  // storage is kept, only target is replaced
+  method.rebind(&c2);
+  ASSERT_TRUE(method.call());
+  ASSERT_EQ(method.result()->get<int>(), 101);
+  method.rebind(&c1, &Counter::sub);
+  ASSERT_TRUE(method.call());
+  ASSERT_EQ(method.result()->get<int>(), 9);
+  ASSERT_EQ(args, method.args());
+  ASSERT_EQ(result, method.result());
+
+  method.reset();
+  ASSERT_FALSE(method.result()->has_value());
+  ASSERT_EQ(method.args()->get<int>(0), 0);
+
+  auto make_lambda = [](int k) { return [k](int v) { return v * k; }; };
+  LambdaDelegate<int, decltype(make_lambda(0)), int> lambda(make_lambda(2), DelegateArgs<int>(5));
+  ASSERT_TRUE(lambda.call());
+  ASSERT_EQ(lambda.result()->get<int>(), 10);
+  for (int k = 3; k < 6; k++) {
+    lambda.rebind(make_lambda(k));
+    ASSERT_TRUE(lambda.call());
+    ASSERT_EQ(lambda.result()->get<int>(), 5 * k);
+  }
+
+  // closure with reference member is destroyed and constructed again on rebind
+  int base1 = 100, base2 = 200;
+  auto make_ref_lambda = [](const int& base) { return [&base](int v) { return base + v; }; };
+  LambdaDelegate<int, decltype(make_ref_lambda(base1)), int> ref_lambda(make_ref_lambda(base1), DelegateArgs<int>(1));
+  ref_lambda.rebind(make_ref_lambda(base2));
+  ASSERT_TRUE(ref_lambda.call());
+  ASSERT_EQ(ref_lambda.result()->get<int>(), 201);
+
+  FunctionalDelegate<int, int> func([](int v) { return v + 1; }, DelegateArgs<int>(1));
+  func.rebind([](int v) { return v + 2; });
+  ASSERT_TRUE(func.call());
+  ASSERT_EQ(func.result()->get<int>(), 3);
+
+  auto shared = std::make_shared<Counter>(Counter{ 7 });
+  std::weak_ptr<Counter> weak = shared;
+  SharedMethodDelegate<Counter, int, int> shared_method(shared, &Counter::add, DelegateArgs<int>(1));
+  shared.reset();
+  ASSERT_FALSE(weak.expired());
+  shared_method.rebind(std::make_shared<Counter>(Counter{ 20 }));
+  ASSERT_TRUE(weak.expired());
+  ASSERT_TRUE(shared_method.call());
+  ASSERT_EQ(shared_method.result()->get<int>(), 21);
+}
+
+namespace {
+
+int delegate_ref_twice(int v) { return v * 2; }
+
+// synchronous visitor style callback
+int delegate_ref_visit(const std::vector<int>& values, DelegateRef<int(int)> visitor) {
+  int sum = 0;
+  for (int v : values)
+    sum += visitor(v);
+  return sum;
+}
+
+}
+
+TEST_F(DeferredCallTests, DelegateRef_NonOwning) {
+  struct Calc {
+    int base_ = 0;
+    int add(int v) { return base_ + v; }
+    int get(int v) const { return base_ * v; }
+  };
+
+  static_assert(sizeof(DelegateRef<int(int)>) == 2 * sizeof(void*), "DelegateRef must be two pointers wide");
+
+  std::vector<int> values = { 1, 2, 3 };
+  int offset = 10;
+  ASSERT_EQ(delegate_ref_visit(values, [&offset](int v) { return v + offset; }), 36);
+  ASSERT_EQ(delegate_ref_visit(values, &delegate_ref_twice), 12);
+
+  Calc calc{ 100 };
+  ASSERT_EQ(delegate_ref_visit(values, DelegateRef<int(int)>::bind<Calc, &Calc::add>(&calc)), 306);
+  const Calc& const_calc = calc;
+  ASSERT_EQ(delegate_ref_visit(values, DelegateRef<int(int)>::bind<Calc, &Calc::get>(&const_calc)), 600);
+
+  // callable is referenced, not copied
+  int calls = 0;
+  auto counter = [&calls](int v) { calls++; return v; };
+  DelegateRef<int(int)> ref(counter);
+  ASSERT_TRUE(static_cast<bool>(ref));
+  ASSERT_FALSE(static_cast<bool>(DelegateRef<int(int)>()));
+  ref(1);
+  ref(2);
+  ASSERT_EQ(calls, 2);
+
+  // IDelegate is created only when deferred call storage is needed
+  std::unique_ptr<IDelegate> deferred = ref.make_unique(5);
+  ASSERT_TRUE(deferred->call());
+  ASSERT_EQ(deferred->result()->get<int>(), 5);
+  ASSERT_EQ(calls, 3);
+
+  auto exclaim = [](std::string& s) { s += "!"; };
+  DelegateRef<void(std::string&)> append(exclaim);
+  std::string text = "hi";
+  append(text);
+  ASSERT_EQ(text, "hi!");
+}
+
+TEST_F(DeferredCallTests, BoundMethodDelegate_CompileTimeMethod) {
+  struct Calc {
+    int base_ = 0;
+    int add(int a, int b) { return base_ + a + b; }
+    int get() const { return base_; }
+    void set(int v) { base_ = v; }
+  };
+
+  static_assert(sizeof(BoundMethodDelegate<decltype(&Calc::add), &Calc::add>) <
+    sizeof(MethodDelegate<Calc, int, int, int>), "Method must not be stored in bound delegate");
+
+  Calc calc{ 10 };
+  std::unique_ptr<IDelegate> add = factory::make_unique_bound_method_delegate<decltype(&Calc::add), &Calc::add>(&calc, 1, 2);
+  ASSERT_TRUE(add->call());
+  ASSERT_EQ(add->result()->get<int>(), 13);
+
+  std::shared_ptr<IDelegate> set = factory::make_shared_bound_method_delegate<decltype(&Calc::set), &Calc::set>(
+    &calc, DelegateArgs<int>(5));
+  ASSERT_TRUE(set->call());
+  ASSERT_EQ(calc.base_, 5);
+
+  const Calc& const_calc = calc;
+  std::unique_ptr<IDelegate> get(factory::make_bound_method_delegate<decltype(&Calc::get), &Calc::get>(&const_calc));
+  ASSERT_TRUE(get->call());
+  ASSERT_EQ(get->result()->get<int>(), 5);
+
+  // compile-time bound delegate is regular IDelegate
+  Signal<int, int, int> sig;
+  sig += std::shared_ptr<IDelegate>(std::move(add));
+  sig.args()->set<int>(0, 3);
+  sig.args()->set<int>(1, 4);
+  ASSERT_TRUE(sig.call());
+  ASSERT_EQ(sig.result()->get<int>(), 12);
+
+  BoundMethodDelegate<decltype(&Calc::add), &Calc::add> null_callee(nullptr, DelegateArgs<int, int>(1, 1));
+  ASSERT_FALSE(null_callee.call());
+  null_callee.rebind(&calc);
+  ASSERT_TRUE(null_callee.call());
+
+#if defined(__cpp_nontype_template_parameter_auto)
+  std::unique_ptr<IDelegate> add17 = factory::make_unique<&Calc::add>(&calc, 1, 1);
+  ASSERT_TRUE(add17->call());
+  ASSERT_EQ(add17->result()->get<int>(), 7);
+#endif //__cpp_nontype_template_parameter_auto
+}
+
+TEST_F(DeferredCallTests, Delegates_ReentrantCallFrames) {
+  std::shared_ptr<IDelegate> concat = factory::make_shared<std::string, const std::string&, int>(
+    [](const std::string& s, int n) { return s + std::to_string(n); });
+
+  // many threads share one delegate, each call has own arguments and result
+  std::vector<std::thread> threads;
+  std::atomic<int> failures(0);
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&concat, &failures, t]() {
+      for (int i = 0; i < 1000; i++) {
+        DelegateCallFrame<std::string, const std::string&, int> frame(std::string("t") + std::to_string(t), i);
+        if (!concat->call(frame) || frame.result()->get<std::string>() != "t" + std::to_string(t) + std::to_string(i))
+          failures++;
+      }
+    });
+  }
+  for (auto& th : threads)
+    th.join();
+
+  ASSERT_EQ(failures.load(), 0);
+  ASSERT_FALSE(concat->result()->has_value());
+
+  // frame types must be exactly the same as delegate types
+  DelegateCallFrame<std::string, std::string, int> wrong_frame(std::string("x"), 1);
+  ASSERT_FALSE(concat->call(wrong_frame));
+
+  Signal<int, int> sig;
+  sig += factory::make_shared<int, int>([](int v) { return v + 1; });
+  DelegateCallFrame<int, int> frame(41);
+  ASSERT_TRUE(sig.call(frame));
+  ASSERT_EQ(frame.result()->get<int>(), 42);
+  ASSERT_FALSE(sig.result()->has_value());
+}
+
+TEST_F(DeferredCallTests, DelegateHandle_IntrusiveOwnership) {
+  static_assert(sizeof(DelegateHandle) == sizeof(void*), "handle must be one pointer wide");
+
+  struct Counter {
+    int* destroyed_;
+    ~Counter() { (*destroyed_)++; }
+    int operator()(int v) const { return v + 1; }
+  };
+
+  int destroyed = 0;
+  int destroyed_at_exit = 0;
+  {
+    DelegateHandle h(factory::make<int, int>(Counter{ &destroyed }, 1));
+    ASSERT_EQ(h.use_count(), 1u);
+    int destroyed_before = destroyed;  // temporaries of Counter
+
+    DelegateHandle copy = h;
+    ASSERT_EQ(h.use_count(), 2u);
+    ASSERT_TRUE(copy == h);
+    ASSERT_TRUE(copy->call());
+    ASSERT_EQ(copy->result()->get<int>(), 2);
+
+    // handle may be constructed from raw pointer of delegate owned by other handles
+    DelegateHandle from_raw(h.get());
+    ASSERT_EQ(h.use_count(), 3u);
+
+    copy.reset();
+    from_raw = DelegateHandle();
+    ASSERT_EQ(h.use_count(), 1u);
+    ASSERT_EQ(destroyed, destroyed_before);
+
+    // signal keeps handle copy
+    Signal<int, int> sig;
+    sig += h;
+    ASSERT_EQ(h.use_count(), 2u);
+    sig.args()->set<int>(0, 41);
+    ASSERT_TRUE(sig.call());
+    ASSERT_EQ(sig.result()->get<int>(), 42);
+
+    sig -= h;
+    ASSERT_EQ(h.use_count(), 1u);
+
+    sig.add(h, "tag");
+    sig.remove("tag");
+    ASSERT_EQ(h.use_count(), 1u);
+
+    // slot removed during call is kept alive by slots snapshot of the call
+    Signal<void, int> self_removing;
+    int self_calls = 0;
+    self_removing.add(DelegateHandle(factory::make<void>([&self_removing, &self_calls]() {
+      self_removing.remove("self");
+      self_calls++;
+    })), "self");
+    ASSERT_TRUE(self_removing.call());
+    ASSERT_TRUE(self_removing.call());
+    ASSERT_EQ(self_calls, 1);
+    destroyed_at_exit = destroyed;
+  }
+  // delegate is deleted with the last handle
+  ASSERT_EQ(destroyed, destroyed_at_exit + 1);
+
+  // fresh delegate adopted by several threads at once gets one reference per handle
+  IDelegate* adopted_raw = factory::make<int, int>([](int v) { return v; }, 0);
+  std::vector<DelegateHandle> adopted(4);
+  std::vector<std::thread> adopters;
+  for (size_t i = 0; i < adopted.size(); i++)
+    adopters.emplace_back([&adopted, adopted_raw, i]() { adopted[i] = DelegateHandle(adopted_raw); });
+  for (auto& t : adopters)
+    t.join();
+  ASSERT_EQ(adopted[0].use_count(), adopted.size());
+  adopted.clear();
+
+  // single-threaded counting
+  DelegateHandle st(factory::make<int, int>([](int v) { return v * 2; }, 2), DelegateRefCount::kSingleThread);
+  {
+    std::vector<DelegateHandle> copies(4, st);
+    ASSERT_EQ(st.use_count(), 5u);
+  }
+  ASSERT_EQ(st.use_count(), 1u);
+
+  TypedDelegate<int, int> typed(st);
+  ASSERT_EQ(typed(5), 10);
+  ASSERT_EQ(st.use_count(), 2u);
+}
+
+TEST_F(DeferredCallTests, DelegateRecycler_CrossThreadReuse) {
+  const size_t kSize = 72;
+  const size_t kCount = 3 * DelegateRecycler::kBatchSize;
+
+  // producer allocates, consumer frees
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < kCount; i++)
+    blocks.push_back(DelegateRecycler::allocate(kSize));
+  std::set<void*> freed(blocks.begin(), blocks.end());
+
+  std::thread consumer([&blocks]() {
+    for (void* p : blocks)
+      DelegateRecycler::deallocate(p, kSize);
+
+    // surplus is passed to depot by batches
+    ASSERT_LE(DelegateRecycler::thread_cached(kSize), static_cast<size_t>(DelegateRecycler::kMaxThreadBlocks));
+  });
+  consumer.join();
+
+  // producer gets blocks back from depot, including blocks cached by exited consumer thread
+  ASSERT_EQ(DelegateRecycler::thread_cached(kSize), 0u);
+  blocks.clear();
+  for (size_t i = 0; i < kCount; i++) {
+    blocks.push_back(DelegateRecycler::allocate(kSize));
+    ASSERT_EQ(freed.count(blocks.back()), 1u);
+  }
+
+  for (void* p : blocks)
+    DelegateRecycler::deallocate(p, kSize);
+
+  // large blocks are not recycled
+  void* large = DelegateRecycler::allocate(DelegateRecycler::kMaxBlockSize + 1);
+  DelegateRecycler::deallocate(large, DelegateRecycler::kMaxBlockSize + 1);
+  ASSERT_EQ(DelegateRecycler::thread_cached(DelegateRecycler::kMaxBlockSize + 1), 0u);
+
+  // block freed by thread_local destructor after thread cache is destroyed goes to global operator delete
+  struct LateFree {
+    void* block_ = nullptr;
+    ~LateFree() { DelegateRecycler::deallocate(block_, kSize); }
+  };
+  std::thread late_thread([]() {
+    static thread_local LateFree late;
+    // thread cache is created after late object, so it is destroyed first
+    late.block_ = DelegateRecycler::allocate(kSize);
+  });
+  late_thread.join();
+}
+
+TEST_F(DeferredCallTests, TupleRuntime_CheckedAndUnchecked) {
+  std::tuple<int, std::string> tup(1, "a");
+
+  ASSERT_EQ(tuple_runtime::runtime_tuple_get_element_type_hash_unchecked(tup, 1), type_id<std::string>());
+  ASSERT_EQ(tuple_runtime::runtime_tuple_get_value_ptr_unchecked(tup, 0), static_cast<void*>(&std::get<0>(tup)));
+
+  int v = 5;
+  ASSERT_TRUE(tuple_runtime::runtime_tuple_set_value_ptr_unchecked(tup, 0, &v, type_id<int>()));
+  ASSERT_EQ(std::get<0>(tup), 5);
+
+  // checked variants without exceptions
+  ASSERT_EQ(tuple_runtime::runtime_tuple_try_get_element_type_hash(tup, 2), 0u);
+  ASSERT_TRUE(tuple_runtime::runtime_tuple_try_get_value_ptr(tup, 2) == nullptr);
+  ASSERT_FALSE(tuple_runtime::runtime_tuple_try_set_value_ptr(tup, 2, &v, type_id<int>()));
+  ASSERT_FALSE(tuple_runtime::runtime_tuple_try_set_value_ptr(tup, 1, &v, type_id<int>()));
+  ASSERT_TRUE(tuple_runtime::runtime_tuple_try_move_value_ptr(tup, 0, &v, type_id<int>()));
+
+  // checked variants with exceptions
+  ASSERT_THROW(tuple_runtime::runtime_tuple_get_value_ptr(tup, 2), std::runtime_error);
+}
+
+TEST_F(DeferredCallTests, DelegateArgs_View) {
+  std::unique_ptr<IDelegate> d = factory::make_unique<int, int, const std::string&, std::vector<int>>(
+    [](int a, const std::string& s, std::vector<int> v) { return a + static_cast<int>(s.size() + v.size()); });
+  IDelegateArgs* args = d->args();
+  args->set<int>(0, 1);
+  args->set<std::string>(1, "abc");
+  args->set(2, std::vector<int>{ 1, 2 });
+
+  auto view = args->view<int, const std::string&, std::vector<int>>();
+  ASSERT_TRUE(view.valid());
+  ASSERT_EQ(view.get<0>(), 1);
+  ASSERT_EQ(view.get<1>(), "abc");
+  ASSERT_EQ(view.get<2>().size(), 2u);
+
+  // view refers to stored values
+  view.get<0>() = 10;
+  ASSERT_EQ(args->get<int>(0), 10);
+  ASSERT_EQ(&args->get_ref<std::string>(1), &view.get<1>());
+
+  int a = 0;
+  std::string s;
+  std::tie(a, s, std::ignore) = view.tuple();
+  ASSERT_EQ(a, 10);
+  ASSERT_EQ(s, "abc");
+
+  // types mismatch
+  ASSERT_FALSE((args->view<int, std::string>().valid()));
+  ASSERT_FALSE((args->view<float, std::string, std::vector<int>>().valid()));
+
+  DelegateArgs<> empty;
+  ASSERT_TRUE(empty.view<>().valid());
+}
+
+TEST_F(DeferredCallTests, Delegates_CallAsync) {
+  std::vector<std::thread> threads;
+  auto executor = [&threads](std::function<void()> task) { threads.emplace_back(std::move(task)); };
+
+  std::unique_ptr<IDelegate> d = factory::make_unique<int, int, int>([](int a, int b) { return a * b; });
+  d->args()->set<int>(0, 6);
+  d->args()->set<int>(1, 7);
+  DelegateFuture future = d->call_async(executor);
+  ASSERT_TRUE(future.valid());
+  ASSERT_TRUE(future.wait());
+  ASSERT_TRUE(future.ready());
+  ASSERT_EQ(future.result()->get<int>(), 42);
+
+  // fan-out / fan-in over typed delegates
+  std::vector<TypedDelegate<std::string, int>> calls;
+  for (int i = 0; i < 4; i++)
+    calls.push_back(factory::make_delegate<std::string, int>([](int v) { return std::to_string(v); }));
+
+  std::vector<TypedDelegateFuture<std::string>> futures;
+  for (int i = 0; i < 4; i++)
+    futures.push_back(calls[i].call_async(executor, i));
+
+  for (int i = 0; i < 4; i++)
+    ASSERT_EQ(futures[i].get(), std::to_string(i));
+
+  // the same delegate may be called again after completion
+  ASSERT_EQ(calls[0].call_async(executor, 10).get(), "10");
+
+  auto void_call = factory::make_delegate<void, int>([](int) {});
+  void_call.call_async(executor, 1).get();
+
+  // failed call is reported by handle
+  struct Callee {
+    int Method(const std::string& v) { return static_cast<int>(v.size()); }
+  };
+  std::shared_ptr<Callee> callee = std::make_shared<Callee>();
+  std::unique_ptr<IDelegate> failing(factory::make_method_delegate(std::weak_ptr<Callee>(callee), &Callee::Method));
+  callee.reset();
+  DelegateFuture failed = failing->call_async(executor);
+  ASSERT_FALSE(failed.wait());
+  ASSERT_TRUE(failed.result() == nullptr);
+
+  ASSERT_FALSE(DelegateFuture().valid());
+
+  // waiters parked on slow call are woken up by completion
+  std::unique_ptr<IDelegate> slow = factory::make_unique<int>([]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return 5;
+  });
+  DelegateFuture slow_future = slow->call_async(executor);
+  std::atomic<int> woken{ 0 };
+  std::vector<std::thread> waiters;
+  for (int i = 0; i < 3; i++)
+    waiters.emplace_back([&slow_future, &woken]() { woken += slow_future.wait() ? 1 : 0; });
+  ASSERT_TRUE(slow_future.wait());
+  for (auto& t : waiters)
+    t.join();
+  ASSERT_EQ(woken.load(), 3);
+  ASSERT_EQ(slow_future.result()->get<int>(), 5);
+
+  for (auto& t : threads)
+    t.join();
+}
+
+#if defined(__cpp_impl_coroutine)
+namespace {
+
+// fire-and-forget coroutine for tests
+struct CoroutineTestTask {
+  struct promise_type {
+    CoroutineTestTask get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+// executor running each task in new thread
+struct ThreadExecutor {
+  std::vector<std::thread>* threads_;
+  template<typename F>
+  void operator()(F&& task) const { threads_->emplace_back(std::forward<F>(task)); }
+};
+
+CoroutineTestTask await_delegates(TypedDelegate<int, int, int>& add, IDelegate* raw, ThreadExecutor executor,
+  std::promise<int>& done) {
+  int sum = co_await async_call(add, executor, 20, 22);
+  std::thread::id worker = std::this_thread::get_id();
+
+  IDelegateResult* result = co_await async_call(raw, InlineExecutor{});
+  if (!result || std::this_thread::get_id() != worker)
+    sum = -1;
+  else
+    sum += result->get<int>();
+
+  done.set_value(sum);
+}
+
+// inline awaits continue without suspension, so long loop does not grow stack
+CoroutineTestTask await_inline_loop(TypedDelegate<int, int, int>& add, int count, int& sum) {
+  for (int i = 0; i < count; i++)
+    sum = co_await async_call(add, InlineExecutor{}, sum, 1);
+}
+
+}
+
+TEST_F(DeferredCallTests, Coroutine_AwaitDelegate) {
+  auto add = factory::make_delegate<int, int, int>([](int a, int b) { return a + b; });
+  std::unique_ptr<IDelegate> raw = factory::make_unique<int>([]() { return 100; });
+
+  std::vector<std::thread> threads;
+  std::promise<int> done;
+  std::future<int> future = done.get_future();
+  await_delegates(add, raw.get(), ThreadExecutor{ &threads }, done);
+
+  ASSERT_EQ(future.get(), 142);
+  for (auto& t : threads)
+    t.join();
+
+  // typed call keeps arguments and result in awaiter frame
+  ASSERT_FALSE(add.has_result());
+
+  int sum = 0;
+  await_inline_loop(add, 1000000, sum);
+  ASSERT_EQ(sum, 1000000);
+}
+#endif //__cpp_impl_coroutine
+
+TEST_F(DeferredCallTests, Delegates_BatchCall) {
+  struct Scaler {
+    float k_ = 1;
+    float scale(int a, float b) { return k_ * (a + b); }
+  };
+
+  const size_t count = 1000;
+  std::vector<int> a(count);
+  std::vector<float> b(count);
+  std::vector<float> out(count);
+  for (size_t i = 0; i < count; i++) {
+    a[i] = static_cast<int>(i);
+    b[i] = 0.5f;
+  }
+
+  std::unique_ptr<IDelegate> lambda = factory::make_unique<float, int, float>([](int x, float y) { return x * y; });
+  ASSERT_TRUE(lambda->call_batch(count, out.data(), a.data(), b.data()));
+  for (size_t i = 0; i < count; i++)
+    ASSERT_FLOAT_EQ(out[i], i * 0.5f);
+  // stored arguments and result are not used
+  ASSERT_FALSE(lambda->result()->has_value());
+
+  Scaler scaler{ 2 };
+  std::unique_ptr<IDelegate> method = factory::make_unique(&scaler, &Scaler::scale, 0, 0.0f);
+  // const columns are accepted for arguments taken by value
+  const int* const_a = a.data();
+  ASSERT_TRUE(method->call_batch(count, out.data(), const_a, b.data()));
+  ASSERT_FLOAT_EQ(out[10], 21.0f);
+
+  // results are optional
+  ASSERT_TRUE(method->call_batch(count, nullptr, a.data(), b.data()));
+
+  // types are checked once for whole batch
+  std::vector<double> wrong(count);
+  ASSERT_FALSE(method->call_batch(count, out.data(), a.data(), wrong.data()));
+  ASSERT_FALSE(method->call_batch(count, wrong.data(), a.data(), b.data()));
+  ASSERT_FALSE(method->call_batch(count, out.data(), a.data()));
+
+  // reference arguments refer to columns elements
+  std::vector<int> acc(4, 1);
+  std::unique_ptr<IDelegate> inc = factory::make_unique<void, int&>([](int& v) { v *= 3; });
+  ASSERT_TRUE(inc->call_batch(acc.size(), nullptr, acc.data()));
+  ASSERT_EQ(acc, std::vector<int>(4, 3));
+  // but not for arguments modified or moved out by target
+  const int* const_acc = acc.data();
+  ASSERT_FALSE(inc->call_batch(acc.size(), nullptr, const_acc));
+  ASSERT_EQ(acc, std::vector<int>(4, 3));
+  std::vector<std::unique_ptr<int> > owned(2);
+  std::unique_ptr<IDelegate> sink = factory::make_unique<void, std::unique_ptr<int> >([](std::unique_ptr<int>) {});
+  const std::unique_ptr<int>* const_owned = owned.data();
+  ASSERT_FALSE(sink->call_batch(owned.size(), nullptr, const_owned));
+  ASSERT_TRUE(sink->call_batch(owned.size(), nullptr, owned.data()));
+
+  // signal slots are called over the same columns
+  int own_calls = 0;
+  Signal<float, int, float> sig;
+  sig += factory::make_shared<float, int, float>([](int x, float y) { return x + y; });
+  sig += factory::make_shared<void>([&own_calls]() { own_calls++; });
+  ASSERT_TRUE(sig.call_batch(count, out.data(), a.data(), b.data()));
+  ASSERT_FLOAT_EQ(out[3], 3.5f);
+  ASSERT_EQ(own_calls, static_cast<int>(count));
+}
+
 // ============================================================================
 // Tests for new TypedDelegate API
 // ============================================================================
@@ -1179,6 +2053,120 @@ TEST_F(DeferredCallTests, TypedDelegate_IndexedArgs) {
   ASSERT_EQ(arg1, 22);
 }
 
+TEST_F(DeferredCallTests, TypedDelegate_DirectInvoke) {
+  struct Counted {
+    static int& copies() { static int n = 0; return n; }
+    Counted() = default;
+    Counted(const Counted&) { copies()++; }
+    Counted(Counted&&) noexcept {}
+    Counted& operator=(const Counted&) { copies()++; return *this; }
+    Counted& operator=(Counted&&) noexcept { return *this; }
+    int value_ = 7;
+  };
+
+  auto measure = delegates::factory::make_delegate<int, const Counted&, int>(
+    [](const Counted& c, int k) { return c.value_ * k; }
+  );
+  ASSERT_TRUE(measure.has_direct_call());
+
+  Counted counted;
+  Counted::copies() = 0;
+  ASSERT_EQ(measure.invoke(counted, 3), 21);
+  ASSERT_EQ(Counted::copies(), 0);
+
+  // stored arguments and result are not touched
+  ASSERT_FALSE(measure.has_result());
+  ASSERT_EQ(measure.get_arg<int>(1), 0);
+
+  // stored path copies argument to storage
+  ASSERT_EQ(measure(counted, 2), 14);
+  ASSERT_GT(Counted::copies(), 0);
+  ASSERT_TRUE(measure.has_result());
+
+  struct Calc {
+    int add(int a, int b) { return a + b; }
+  };
+  Calc calc;
+  auto add = delegates::factory::make_delegate(&calc, &Calc::add);
+  ASSERT_EQ(add.invoke(2, 3), 5);
+
+  // the same interface is available for untyped delegate
+  std::unique_ptr<IDelegate> raw = delegates::factory::make_unique(&calc, &Calc::add, 0, 0);
+  IDelegateInvoke<int, int, int>* invoker = raw->invoker<int, int, int>();
+  ASSERT_TRUE(invoker != nullptr);
+  ASSERT_TRUE((raw->invoker<int, int, float>() == nullptr));
+  ASSERT_EQ(invoker->invoke(4, 5), 9);
+
+  // signals are called through stored arguments
+  std::shared_ptr<ISignal> sig = delegates::factory::make_shared_signal<int, int, int>();
+  sig->add(delegates::factory::make_shared(&calc, &Calc::add, 0, 0));
+  TypedDelegate<int, int, int> typed_sig(sig);
+  ASSERT_FALSE(typed_sig.has_direct_call());
+  ASSERT_EQ(typed_sig.invoke(1, 1), 2);
+}
+
+TEST_F(DeferredCallTests, TypedDelegate_TakeResult) {
+  auto fill = delegates::factory::make_delegate<std::vector<int>, size_t>(
+    [](size_t n) { return std::vector<int>(n, 1); }
+  );
+
+  fill.set_arg<size_t>(0, 1000);
+  ASSERT_TRUE(fill.call());
+  const int* data = reinterpret_cast<const std::vector<int>*>(fill.result()->get_ptr())->data();
+
+  // value is moved out, not copied
+  std::vector<int> taken = fill.take_result();
+  ASSERT_EQ(taken.size(), 1000);
+  ASSERT_EQ(taken.data(), data);
+  ASSERT_FALSE(fill.has_result());
+
+  // delegate is reused by next call
+  ASSERT_TRUE(fill.call());
+  ASSERT_EQ(fill.take_result().size(), 1000);
+}
+
+TEST_F(DeferredCallTests, TypedDelegate_MoveOnlyResult) {
+  struct Frame {
+    std::vector<uint8_t> data;
+  };
+
+  auto decode = delegates::factory::make_delegate<std::unique_ptr<Frame>, size_t>(
+    [](size_t n) {
+      std::unique_ptr<Frame> f(new Frame());
+      f->data.resize(n);
+      return f;
+    }
+  );
+
+  std::unique_ptr<Frame> frame = decode(640);
+  ASSERT_TRUE(frame != nullptr);
+  ASSERT_EQ(frame->data.size(), 640);
+  ASSERT_FALSE(decode.has_result());
+
+  // untyped interface reports that copy is impossible
+  IDelegateResult* result = decode.result();
+  ASSERT_FALSE(result->copyable());
+  ASSERT_FALSE(result->set_ptr(&frame, type_id<std::unique_ptr<Frame>>()));
+  ASSERT_TRUE(result->set(std::move(frame)));
+  ASSERT_TRUE(frame == nullptr);
+  ASSERT_EQ(result->take<std::unique_ptr<Frame> >()->data.size(), 640);
+  // taken value is always returned by value, reference to it would dangle
+  static_assert(std::is_same<decltype(result->take<std::unique_ptr<Frame>&>()), std::unique_ptr<Frame> >::value,
+    "take() must return value");
+
+  // move-only results are passed through signals
+  Signal<std::unique_ptr<Frame>, size_t> sig;
+  sig += delegates::factory::make_shared<std::unique_ptr<Frame>, size_t>([](size_t n) {
+    std::unique_ptr<Frame> f(new Frame());
+    f->data.resize(n);
+    return f;
+  });
+  sig.args()->set<size_t>(0, 32);
+  ASSERT_TRUE(sig.call());
+  ASSERT_EQ(sig.result()->take<std::unique_ptr<Frame> >()->data.size(), 32);
+  ASSERT_FALSE(sig.result()->has_value());
+}
+
 // ============================================================================
 // Tests for function_traits
 // ============================================================================